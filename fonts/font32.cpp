@@ -0,0 +1,3248 @@
+/**
+ * This file provides 'Menlo' [32px] text font
+ * for STM32xx-EVAL's LCD driver.
+ *
+ * Generated by zst123 on 2018-01-01 21:12:19
+ */
+#pragma once
+
+#include "fonts.h"
+
+// 9120 bytes
+const uint8_t Font32_Table [] = {
+    // @0 ' ' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @96 '!' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @192 '"' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1C, 0x1E, 0x00, /* |   ###     ####     | */
+    0x1C, 0x1E, 0x00, /* |   ###     ####     | */
+    0x1C, 0x1E, 0x00, /* |   ###     ####     | */
+    0x1C, 0x1E, 0x00, /* |   ###     ####     | */
+    0x1C, 0x1E, 0x00, /* |   ###     ####     | */
+    0x1C, 0x1E, 0x00, /* |   ###     ####     | */
+    0x1C, 0x1E, 0x00, /* |   ###     ####     | */
+    0x1C, 0x1E, 0x00, /* |   ###     ####     | */
+    0x1C, 0x1E, 0x00, /* |   ###     ####     | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @288 '#' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0xE3, 0x80, /* |        ###   ###   | */
+    0x00, 0xC3, 0x80, /* |        ##    ###   | */
+    0x00, 0xC3, 0x00, /* |        ##    ##    | */
+    0x01, 0xC3, 0x00, /* |       ###    ##    | */
+    0x01, 0xC7, 0x00, /* |       ###   ###    | */
+    0x01, 0x87, 0x00, /* |       ##    ###    | */
+    0x3F, 0xFF, 0xE0, /* |  ################# | */
+    0x3F, 0xFF, 0xE0, /* |  ################# | */
+    0x03, 0x8E, 0x00, /* |      ###   ###     | */
+    0x03, 0x0E, 0x00, /* |      ##    ###     | */
+    0x03, 0x0C, 0x00, /* |      ##    ##      | */
+    0x07, 0x0C, 0x00, /* |     ###    ##      | */
+    0x07, 0x1C, 0x00, /* |     ###   ###      | */
+    0x06, 0x1C, 0x00, /* |     ##    ###      | */
+    0xFF, 0xFF, 0x80, /* |#################   | */
+    0xFF, 0xFF, 0x80, /* |#################   | */
+    0x0C, 0x38, 0x00, /* |    ##    ###       | */
+    0x0C, 0x38, 0x00, /* |    ##    ###       | */
+    0x1C, 0x30, 0x00, /* |   ###    ##        | */
+    0x1C, 0x30, 0x00, /* |   ###    ##        | */
+    0x1C, 0x70, 0x00, /* |   ###   ###        | */
+    0x18, 0x70, 0x00, /* |   ##    ###        | */
+    0x18, 0x60, 0x00, /* |   ##    ##         | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @384 '$' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x01, 0xFC, 0x00, /* |       #######      | */
+    0x07, 0xFF, 0x00, /* |     ###########    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x1E, 0x63, 0x00, /* |   ####  ##   ##    | */
+    0x1C, 0x60, 0x00, /* |   ###   ##         | */
+    0x1C, 0x60, 0x00, /* |   ###   ##         | */
+    0x1C, 0x60, 0x00, /* |   ###   ##         | */
+    0x1C, 0x60, 0x00, /* |   ###   ##         | */
+    0x0E, 0x60, 0x00, /* |    ###  ##         | */
+    0x0F, 0xE0, 0x00, /* |    #######         | */
+    0x03, 0xFC, 0x00, /* |      ########      | */
+    0x00, 0xFF, 0x00, /* |        ########    | */
+    0x00, 0x67, 0x80, /* |         ##  ####   | */
+    0x00, 0x63, 0x80, /* |         ##   ###   | */
+    0x00, 0x63, 0x80, /* |         ##   ###   | */
+    0x00, 0x63, 0x80, /* |         ##   ###   | */
+    0x00, 0x63, 0x80, /* |         ##   ###   | */
+    0x18, 0x67, 0x80, /* |   ##    ##  ####   | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x07, 0xF8, 0x00, /* |     ########       | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+
+    // @480 '%' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1F, 0x00, 0x00, /* |   #####            | */
+    0x3F, 0x80, 0x00, /* |  #######           | */
+    0x71, 0xC0, 0x00, /* | ###   ###          | */
+    0x60, 0xC0, 0x00, /* | ##     ##          | */
+    0x60, 0xC0, 0x00, /* | ##     ##          | */
+    0x60, 0xC0, 0x00, /* | ##     ##          | */
+    0x60, 0xC0, 0x00, /* | ##     ##          | */
+    0x71, 0xC1, 0xE0, /* | ###   ###     #### | */
+    0x3F, 0x87, 0xC0, /* |  #######    #####  | */
+    0x1F, 0x3E, 0x00, /* |   #####  #####     | */
+    0x00, 0xF8, 0x00, /* |        #####       | */
+    0x07, 0xC0, 0x00, /* |     #####          | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x78, 0x3F, 0x80, /* | ####     #######   | */
+    0x60, 0x71, 0xC0, /* | ##      ###   ###  | */
+    0x00, 0x60, 0xC0, /* |         ##     ##  | */
+    0x00, 0x60, 0x60, /* |         ##      ## | */
+    0x00, 0x60, 0x60, /* |         ##      ## | */
+    0x00, 0x60, 0xE0, /* |         ##     ### | */
+    0x00, 0x71, 0xC0, /* |         ###   ###  | */
+    0x00, 0x3F, 0x80, /* |          #######   | */
+    0x00, 0x0F, 0x00, /* |            ####    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @576 '&' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x0F, 0xFC, 0x00, /* |    ##########      | */
+    0x0F, 0x04, 0x00, /* |    ####     #      | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0C, 0x00, 0x00, /* |    ##              | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x07, 0x00, 0x00, /* |     ###            | */
+    0x0F, 0x80, 0x00, /* |    #####           | */
+    0x1F, 0xC0, 0x00, /* |   #######          | */
+    0x39, 0xE0, 0xE0, /* |  ###  ####     ### | */
+    0x30, 0xE0, 0xE0, /* |  ##    ###     ### | */
+    0x70, 0x70, 0xE0, /* | ###     ###    ### | */
+    0x70, 0x38, 0xC0, /* | ###      ###   ##  | */
+    0x70, 0x1C, 0xC0, /* | ###       ###  ##  | */
+    0x70, 0x1F, 0xC0, /* | ###       #######  | */
+    0x70, 0x0F, 0x80, /* | ###        #####   | */
+    0x78, 0x07, 0x80, /* | ####        ####   | */
+    0x3E, 0x0F, 0x80, /* |  #####     #####   | */
+    0x1F, 0xFF, 0xC0, /* |   ###############  | */
+    0x0F, 0xF9, 0xC0, /* |    #########  ###  | */
+    0x03, 0xE0, 0xE0, /* |      #####     ### | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @672 ''' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @768 '(' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x18, 0x00, /* |           ##       | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xC0, 0x00, /* |        ##          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x00, 0xC0, 0x00, /* |        ##          | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x18, 0x00, /* |           ##       | */
+
+    // @864 ')' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x03, 0x00, 0x00, /* |      ##            | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x01, 0x80, 0x00, /* |       ##           | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x00, 0xC0, 0x00, /* |        ##          | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x78, 0x00, /* |         ####       | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xC0, 0x00, /* |        ##          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0x80, 0x00, /* |       ##           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x00, 0x00, /* |      ##            | */
+
+    // @960 '*' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x70, 0x61, 0xC0, /* | ###     ##    ###  | */
+    0x7C, 0x63, 0xC0, /* | #####   ##   ####  | */
+    0x1E, 0x6F, 0x00, /* |   ####  ## ####    | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x1E, 0x6F, 0x00, /* |   ####  ## ####    | */
+    0x7C, 0x63, 0xC0, /* | #####   ##   ####  | */
+    0x70, 0x61, 0xC0, /* | ###     ##    ###  | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @1056 '+' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x3F, 0xFF, 0xC0, /* |  ################  | */
+    0x3F, 0xFF, 0xC0, /* |  ################  | */
+    0x3F, 0xFF, 0xC0, /* |  ################  | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @1152 ',' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xE0, 0x00, /* |       ####         | */
+    0x03, 0xE0, 0x00, /* |      #####         | */
+    0x03, 0xC0, 0x00, /* |      ####          | */
+    0x03, 0xC0, 0x00, /* |      ####          | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+
+    // @1248 '-' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x3F, 0xFF, 0xC0, /* |  ################  | */
+    0x3F, 0xFF, 0xC0, /* |  ################  | */
+    0x3F, 0xFF, 0xC0, /* |  ################  | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @1344 '.' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x03, 0xF0, 0x00, /* |      ######        | */
+    0x03, 0xF0, 0x00, /* |      ######        | */
+    0x03, 0xF0, 0x00, /* |      ######        | */
+    0x03, 0xF0, 0x00, /* |      ######        | */
+    0x03, 0xF0, 0x00, /* |      ######        | */
+    0x03, 0xF0, 0x00, /* |      ######        | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @1440 '/' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x03, 0x80, /* |              ###   | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x1C, 0x00, /* |           ###      | */
+    0x00, 0x1C, 0x00, /* |           ###      | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xC0, 0x00, /* |        ##          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x07, 0x00, 0x00, /* |     ###            | */
+    0x07, 0x00, 0x00, /* |     ###            | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+
+    // @1536 '0' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+    0x0F, 0x1E, 0x00, /* |    ####   ####     | */
+    0x1E, 0x0F, 0x00, /* |   ####     ####    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x0F, 0x80, /* |   ###      #####   | */
+    0x3C, 0x1F, 0x80, /* |  ####     ######   | */
+    0x3C, 0x1B, 0x80, /* |  ####     ## ###   | */
+    0x38, 0x3B, 0x80, /* |  ###     ### ###   | */
+    0x38, 0x73, 0x80, /* |  ###    ###  ###   | */
+    0x38, 0x63, 0x80, /* |  ###    ##   ###   | */
+    0x38, 0xE3, 0x80, /* |  ###   ###   ###   | */
+    0x38, 0xC3, 0x80, /* |  ###   ##    ###   | */
+    0x39, 0x83, 0x80, /* |  ###  ##     ###   | */
+    0x3B, 0x83, 0x80, /* |  ### ###     ###   | */
+    0x3F, 0x03, 0x80, /* |  ######      ###   | */
+    0x3E, 0x03, 0x80, /* |  #####       ###   | */
+    0x1E, 0x07, 0x80, /* |   ####      ####   | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1E, 0x0F, 0x00, /* |   ####     ####    | */
+    0x0F, 0x1E, 0x00, /* |    ####   ####     | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @1632 '1' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x03, 0xF0, 0x00, /* |      ######        | */
+    0x0F, 0xF0, 0x00, /* |    ########        | */
+    0x1F, 0x70, 0x00, /* |   ##### ###        | */
+    0x1C, 0x70, 0x00, /* |   ###   ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x0F, 0xFF, 0x80, /* |    #############   | */
+    0x0F, 0xFF, 0x80, /* |    #############   | */
+    0x0F, 0xFF, 0x80, /* |    #############   | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @1728 '2' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x07, 0xF0, 0x00, /* |     #######        | */
+    0x1F, 0xFC, 0x00, /* |   ###########      | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x18, 0x1F, 0x00, /* |   ##      #####    | */
+    0x00, 0x0F, 0x00, /* |            ####    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x1C, 0x00, /* |           ###      | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x07, 0x00, 0x00, /* |     ###            | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x3F, 0xFF, 0x80, /* |  ###############   | */
+    0x3F, 0xFF, 0x80, /* |  ###############   | */
+    0x3F, 0xFF, 0x80, /* |  ###############   | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @1824 '3' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x07, 0xF0, 0x00, /* |     #######        | */
+    0x1F, 0xFC, 0x00, /* |   ###########      | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x18, 0x1F, 0x00, /* |   ##      #####    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x1E, 0x00, /* |           ####     | */
+    0x03, 0xFC, 0x00, /* |      ########      | */
+    0x03, 0xF8, 0x00, /* |      #######       | */
+    0x03, 0xFC, 0x00, /* |      ########      | */
+    0x00, 0x1F, 0x00, /* |           #####    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x80, /* |             ####   | */
+    0x00, 0x03, 0x80, /* |              ###   | */
+    0x00, 0x03, 0x80, /* |              ###   | */
+    0x00, 0x07, 0x80, /* |             ####   | */
+    0x00, 0x07, 0x80, /* |             ####   | */
+    0x30, 0x1F, 0x00, /* |  ##       #####    | */
+    0x3F, 0xFE, 0x00, /* |  #############     | */
+    0x3F, 0xFC, 0x00, /* |  ############      | */
+    0x0F, 0xF0, 0x00, /* |    ########        | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @1920 '4' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x1E, 0x00, /* |           ####     | */
+    0x00, 0x3E, 0x00, /* |          #####     | */
+    0x00, 0x7E, 0x00, /* |         ######     | */
+    0x00, 0x7E, 0x00, /* |         ######     | */
+    0x00, 0xDE, 0x00, /* |        ## ####     | */
+    0x00, 0xDE, 0x00, /* |        ## ####     | */
+    0x01, 0x9E, 0x00, /* |       ##  ####     | */
+    0x03, 0x9E, 0x00, /* |      ###  ####     | */
+    0x03, 0x1E, 0x00, /* |      ##   ####     | */
+    0x06, 0x1E, 0x00, /* |     ##    ####     | */
+    0x0E, 0x1E, 0x00, /* |    ###    ####     | */
+    0x0C, 0x1E, 0x00, /* |    ##     ####     | */
+    0x1C, 0x1E, 0x00, /* |   ###     ####     | */
+    0x18, 0x1E, 0x00, /* |   ##      ####     | */
+    0x30, 0x1E, 0x00, /* |  ##       ####     | */
+    0x3F, 0xFF, 0xC0, /* |  ################  | */
+    0x3F, 0xFF, 0xC0, /* |  ################  | */
+    0x3F, 0xFF, 0xC0, /* |  ################  | */
+    0x00, 0x1E, 0x00, /* |           ####     | */
+    0x00, 0x1E, 0x00, /* |           ####     | */
+    0x00, 0x1E, 0x00, /* |           ####     | */
+    0x00, 0x1E, 0x00, /* |           ####     | */
+    0x00, 0x1E, 0x00, /* |           ####     | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @2016 '5' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1F, 0xF0, 0x00, /* |   #########        | */
+    0x1F, 0xFC, 0x00, /* |   ###########      | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x18, 0x1F, 0x00, /* |   ##      #####    | */
+    0x00, 0x0F, 0x00, /* |            ####    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x80, /* |             ####   | */
+    0x00, 0x03, 0x80, /* |              ###   | */
+    0x00, 0x07, 0x80, /* |             ####   | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x0F, 0x00, /* |            ####    | */
+    0x30, 0x1F, 0x00, /* |  ##       #####    | */
+    0x3F, 0xFE, 0x00, /* |  #############     | */
+    0x3F, 0xFC, 0x00, /* |  ############      | */
+    0x0F, 0xF0, 0x00, /* |    ########        | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @2112 '6' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0xFC, 0x00, /* |        ######      | */
+    0x03, 0xFE, 0x00, /* |      #########     | */
+    0x07, 0xFE, 0x00, /* |     ##########     | */
+    0x0F, 0x82, 0x00, /* |    #####     #     | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x3C, 0x00, 0x00, /* |  ####              | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x38, 0xF8, 0x00, /* |  ###   #####       | */
+    0x3B, 0xFE, 0x00, /* |  ### #########     | */
+    0x3B, 0xFF, 0x00, /* |  ### ##########    | */
+    0x3F, 0x0F, 0x00, /* |  ######    ####    | */
+    0x3C, 0x07, 0x80, /* |  ####       ####   | */
+    0x3C, 0x03, 0x80, /* |  ####        ###   | */
+    0x3C, 0x03, 0x80, /* |  ####        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x0F, 0x0F, 0x00, /* |    ####    ####    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x07, 0xFE, 0x00, /* |     ##########     | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @2208 '7' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x3F, 0xFF, 0x80, /* |  ###############   | */
+    0x3F, 0xFF, 0x80, /* |  ###############   | */
+    0x3F, 0xFF, 0x00, /* |  ##############    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0C, 0x00, /* |            ##      | */
+    0x00, 0x1C, 0x00, /* |           ###      | */
+    0x00, 0x1C, 0x00, /* |           ###      | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x78, 0x00, /* |         ####       | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x01, 0xE0, 0x00, /* |       ####         | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x07, 0x80, 0x00, /* |     ####           | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @2304 '8' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x03, 0xF8, 0x00, /* |      #######       | */
+    0x07, 0xFE, 0x00, /* |     ##########     | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x1E, 0x0F, 0x00, /* |   ####     ####    | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x0E, 0x0F, 0x00, /* |    ###     ####    | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x03, 0xF8, 0x00, /* |      #######       | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+    0x1E, 0x0F, 0x00, /* |   ####     ####    | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x3C, 0x07, 0x80, /* |  ####       ####   | */
+    0x1E, 0x0F, 0x80, /* |   ####     #####   | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+    0x03, 0xF8, 0x00, /* |      #######       | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @2400 '9' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x03, 0xF0, 0x00, /* |      ######        | */
+    0x0F, 0xFC, 0x00, /* |    ##########      | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x1E, 0x0F, 0x00, /* |   ####     ####    | */
+    0x3C, 0x07, 0x00, /* |  ####       ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x07, 0x80, /* |  ###        ####   | */
+    0x3C, 0x07, 0x80, /* |  ####       ####   | */
+    0x1E, 0x0F, 0x80, /* |   ####     #####   | */
+    0x1F, 0xFF, 0x80, /* |   ##############   | */
+    0x0F, 0xFB, 0x80, /* |    ######### ###   | */
+    0x03, 0xE3, 0x80, /* |      #####   ###   | */
+    0x00, 0x03, 0x80, /* |              ###   | */
+    0x00, 0x03, 0x80, /* |              ###   | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x0F, 0x00, /* |            ####    | */
+    0x08, 0x3E, 0x00, /* |    #     #####     | */
+    0x0F, 0xFC, 0x00, /* |    ##########      | */
+    0x0F, 0xF8, 0x00, /* |    #########       | */
+    0x07, 0xE0, 0x00, /* |     ######         | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @2496 ':' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @2592 ';' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xE0, 0x00, /* |       ####         | */
+    0x03, 0xE0, 0x00, /* |      #####         | */
+    0x03, 0xC0, 0x00, /* |      ####          | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+
+    // @2688 '<' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x40, /* |                 #  | */
+    0x00, 0x03, 0xC0, /* |              ####  | */
+    0x00, 0x0F, 0xC0, /* |            ######  | */
+    0x00, 0x7F, 0x00, /* |         #######    | */
+    0x01, 0xFC, 0x00, /* |       #######      | */
+    0x0F, 0xE0, 0x00, /* |    #######         | */
+    0x3F, 0x80, 0x00, /* |  #######           | */
+    0x7C, 0x00, 0x00, /* | #####              | */
+    0x7C, 0x00, 0x00, /* | #####              | */
+    0x3F, 0x00, 0x00, /* |  ######            | */
+    0x0F, 0xE0, 0x00, /* |    #######         | */
+    0x01, 0xFC, 0x00, /* |       #######      | */
+    0x00, 0x7F, 0x00, /* |         #######    | */
+    0x00, 0x0F, 0xC0, /* |            ######  | */
+    0x00, 0x03, 0xC0, /* |              ####  | */
+    0x00, 0x00, 0x40, /* |                 #  | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @2784 '=' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x7F, 0xFF, 0xC0, /* | #################  | */
+    0x7F, 0xFF, 0xC0, /* | #################  | */
+    0x7F, 0xFF, 0xC0, /* | #################  | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x7F, 0xFF, 0xC0, /* | #################  | */
+    0x7F, 0xFF, 0xC0, /* | #################  | */
+    0x7F, 0xFF, 0xC0, /* | #################  | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @2880 '>' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x60, 0x00, 0x00, /* | ##                 | */
+    0x78, 0x00, 0x00, /* | ####               | */
+    0x7F, 0x00, 0x00, /* | #######            | */
+    0x1F, 0xC0, 0x00, /* |   #######          | */
+    0x03, 0xF8, 0x00, /* |      #######       | */
+    0x00, 0xFE, 0x00, /* |        #######     | */
+    0x00, 0x1F, 0x80, /* |           ######   | */
+    0x00, 0x07, 0xC0, /* |             #####  | */
+    0x00, 0x07, 0xC0, /* |             #####  | */
+    0x00, 0x1F, 0x80, /* |           ######   | */
+    0x00, 0xFE, 0x00, /* |        #######     | */
+    0x03, 0xF8, 0x00, /* |      #######       | */
+    0x1F, 0xC0, 0x00, /* |   #######          | */
+    0x7F, 0x00, 0x00, /* | #######            | */
+    0x78, 0x00, 0x00, /* | ####               | */
+    0x60, 0x00, 0x00, /* | ##                 | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @2976 '?' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+    0x0E, 0x1F, 0x00, /* |    ###    #####    | */
+    0x08, 0x07, 0x00, /* |    #        ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x1C, 0x00, /* |           ###      | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @3072 '@' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0xFC, 0x00, /* |        ######      | */
+    0x03, 0xFF, 0x00, /* |      ##########    | */
+    0x0F, 0x07, 0x80, /* |    ####     ####   | */
+    0x1E, 0x01, 0x80, /* |   ####        ##   | */
+    0x18, 0x01, 0xC0, /* |   ##          ###  | */
+    0x38, 0x00, 0xC0, /* |  ###           ##  | */
+    0x30, 0x00, 0xC0, /* |  ##            ##  | */
+    0x70, 0x3C, 0xC0, /* | ###      ####  ##  | */
+    0x60, 0xFF, 0xC0, /* | ##     ##########  | */
+    0x60, 0xE3, 0xC0, /* | ##     ###   ####  | */
+    0x61, 0xC1, 0xC0, /* | ##    ###     ###  | */
+    0x61, 0x80, 0xC0, /* | ##    ##       ##  | */
+    0xE1, 0x80, 0xC0, /* |###    ##       ##  | */
+    0xE3, 0x80, 0xC0, /* |###   ###       ##  | */
+    0x61, 0x80, 0xC0, /* | ##    ##       ##  | */
+    0x61, 0x80, 0xC0, /* | ##    ##       ##  | */
+    0x61, 0xC1, 0xC0, /* | ##    ###     ###  | */
+    0x60, 0xE3, 0xC0, /* | ##     ###   ####  | */
+    0x70, 0xFF, 0xC0, /* | ###    ##########  | */
+    0x30, 0x3E, 0xC0, /* |  ##      ##### ##  | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x0F, 0x00, 0x00, /* |    ####            | */
+    0x07, 0xFF, 0x80, /* |     ############   | */
+    0x01, 0xFF, 0x80, /* |       ##########   | */
+
+    // @3168 'A' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xB8, 0x00, /* |       ## ###       | */
+    0x03, 0xB8, 0x00, /* |      ### ###       | */
+    0x03, 0xB8, 0x00, /* |      ### ###       | */
+    0x03, 0x1C, 0x00, /* |      ##   ###      | */
+    0x07, 0x1C, 0x00, /* |     ###   ###      | */
+    0x07, 0x1C, 0x00, /* |     ###   ###      | */
+    0x07, 0x0C, 0x00, /* |     ###    ##      | */
+    0x0E, 0x0E, 0x00, /* |    ###     ###     | */
+    0x0E, 0x0E, 0x00, /* |    ###     ###     | */
+    0x0E, 0x06, 0x00, /* |    ###      ##     | */
+    0x0C, 0x07, 0x00, /* |    ##       ###    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFF, 0x80, /* |   ##############   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0xC0, /* |  ###         ####  | */
+    0x78, 0x01, 0xC0, /* | ####          ###  | */
+    0x70, 0x01, 0xC0, /* | ###           ###  | */
+    0x70, 0x01, 0xE0, /* | ###           #### | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @3264 'B' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1F, 0xF8, 0x00, /* |   ##########       | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1C, 0x0F, 0x00, /* |   ###      ####    | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x1C, 0x0F, 0x00, /* |   ###      ####    | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x1F, 0xFC, 0x00, /* |   ###########      | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x1C, 0x0F, 0x00, /* |   ###      ####    | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0xC0, /* |   ###        ####  | */
+    0x1C, 0x01, 0xC0, /* |   ###         ###  | */
+    0x1C, 0x01, 0xC0, /* |   ###         ###  | */
+    0x1C, 0x03, 0xC0, /* |   ###        ####  | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x1F, 0xF8, 0x00, /* |   ##########       | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @3360 'C' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x7C, 0x00, /* |         #####      | */
+    0x03, 0xFF, 0x00, /* |      ##########    | */
+    0x07, 0xFF, 0x80, /* |     ############   | */
+    0x0F, 0x83, 0x80, /* |    #####     ###   | */
+    0x0F, 0x00, 0x80, /* |    ####        #   | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x3C, 0x00, 0x00, /* |  ####              | */
+    0x3C, 0x00, 0x00, /* |  ####              | */
+    0x3C, 0x00, 0x00, /* |  ####              | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x3C, 0x00, 0x00, /* |  ####              | */
+    0x3C, 0x00, 0x00, /* |  ####              | */
+    0x3C, 0x00, 0x00, /* |  ####              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x0F, 0x00, 0x80, /* |    ####        #   | */
+    0x0F, 0x83, 0x80, /* |    #####     ###   | */
+    0x07, 0xFF, 0x80, /* |     ############   | */
+    0x03, 0xFF, 0x00, /* |      ##########    | */
+    0x00, 0xFC, 0x00, /* |        ######      | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @3456 'D' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x3F, 0xE0, 0x00, /* |  #########         | */
+    0x3F, 0xF8, 0x00, /* |  ###########       | */
+    0x3F, 0xFC, 0x00, /* |  ############      | */
+    0x38, 0x3E, 0x00, /* |  ###     #####     | */
+    0x38, 0x0F, 0x00, /* |  ###       ####    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x80, /* |  ###        ####   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x07, 0x80, /* |  ###        ####   | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x0F, 0x00, /* |  ###       ####    | */
+    0x38, 0x3E, 0x00, /* |  ###     #####     | */
+    0x3F, 0xFC, 0x00, /* |  ############      | */
+    0x3F, 0xF8, 0x00, /* |  ###########       | */
+    0x3F, 0xE0, 0x00, /* |  #########         | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @3552 'E' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1F, 0xFF, 0x80, /* |   ##############   | */
+    0x1F, 0xFF, 0x80, /* |   ##############   | */
+    0x1F, 0xFF, 0x80, /* |   ##############   | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1F, 0xFF, 0x80, /* |   ##############   | */
+    0x1F, 0xFF, 0x80, /* |   ##############   | */
+    0x1F, 0xFF, 0x80, /* |   ##############   | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @3648 'F' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x0F, 0xFF, 0x80, /* |    #############   | */
+    0x0F, 0xFF, 0x80, /* |    #############   | */
+    0x0F, 0xFF, 0x80, /* |    #############   | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @3744 'G' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0xFC, 0x00, /* |        ######      | */
+    0x03, 0xFF, 0x00, /* |      ##########    | */
+    0x07, 0xFF, 0x00, /* |     ###########    | */
+    0x0F, 0x83, 0x00, /* |    #####     ##    | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x3C, 0x00, 0x00, /* |  ####              | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x38, 0x1F, 0x80, /* |  ###      ######   | */
+    0x38, 0x1F, 0x80, /* |  ###      ######   | */
+    0x38, 0x1F, 0x80, /* |  ###      ######   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x3C, 0x03, 0x80, /* |  ####        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1E, 0x03, 0x80, /* |   ####       ###   | */
+    0x0F, 0x07, 0x80, /* |    ####     ####   | */
+    0x07, 0xFF, 0x80, /* |     ############   | */
+    0x03, 0xFF, 0x00, /* |      ##########    | */
+    0x00, 0xFC, 0x00, /* |        ######      | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @3840 'H' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x3F, 0xFF, 0x80, /* |  ###############   | */
+    0x3F, 0xFF, 0x80, /* |  ###############   | */
+    0x3F, 0xFF, 0x80, /* |  ###############   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @3936 'I' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @4032 'J' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x03, 0xFE, 0x00, /* |      #########     | */
+    0x03, 0xFE, 0x00, /* |      #########     | */
+    0x03, 0xFE, 0x00, /* |      #########     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x1E, 0x00, /* |           ####     | */
+    0x20, 0x1C, 0x00, /* |  #        ###      | */
+    0x38, 0x3C, 0x00, /* |  ###     ####      | */
+    0x3F, 0xFC, 0x00, /* |  ############      | */
+    0x1F, 0xF8, 0x00, /* |   ##########       | */
+    0x07, 0xE0, 0x00, /* |     ######         | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @4128 'K' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x38, 0x01, 0xC0, /* |  ###          ###  | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x0E, 0x00, /* |  ###       ###     | */
+    0x38, 0x1E, 0x00, /* |  ###      ####     | */
+    0x38, 0x3C, 0x00, /* |  ###     ####      | */
+    0x38, 0x78, 0x00, /* |  ###    ####       | */
+    0x38, 0xF0, 0x00, /* |  ###   ####        | */
+    0x39, 0xE0, 0x00, /* |  ###  ####         | */
+    0x3B, 0xC0, 0x00, /* |  ### ####          | */
+    0x3F, 0xE0, 0x00, /* |  #########         | */
+    0x3F, 0xE0, 0x00, /* |  #########         | */
+    0x3E, 0xF0, 0x00, /* |  ##### ####        | */
+    0x3C, 0x78, 0x00, /* |  ####   ####       | */
+    0x38, 0x38, 0x00, /* |  ###     ###       | */
+    0x38, 0x3C, 0x00, /* |  ###     ####      | */
+    0x38, 0x1E, 0x00, /* |  ###      ####     | */
+    0x38, 0x0E, 0x00, /* |  ###       ###     | */
+    0x38, 0x0F, 0x00, /* |  ###       ####    | */
+    0x38, 0x07, 0x80, /* |  ###        ####   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0xC0, /* |  ###         ####  | */
+    0x38, 0x01, 0xE0, /* |  ###          #### | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @4224 'L' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x1F, 0xFF, 0xC0, /* |   ###############  | */
+    0x1F, 0xFF, 0xC0, /* |   ###############  | */
+    0x1F, 0xFF, 0xC0, /* |   ###############  | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @4320 'M' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x78, 0x07, 0x80, /* | ####        ####   | */
+    0x78, 0x0F, 0x80, /* | ####       #####   | */
+    0x7C, 0x0F, 0x80, /* | #####      #####   | */
+    0x7C, 0x0F, 0x80, /* | #####      #####   | */
+    0x6C, 0x1F, 0x80, /* | ## ##     ######   | */
+    0x6E, 0x1B, 0x80, /* | ## ###    ## ###   | */
+    0x66, 0x1B, 0x80, /* | ##  ##    ## ###   | */
+    0x66, 0x3B, 0x80, /* | ##  ##   ### ###   | */
+    0x67, 0x33, 0x80, /* | ##  ###  ##  ###   | */
+    0x63, 0x33, 0x80, /* | ##   ##  ##  ###   | */
+    0x63, 0x73, 0x80, /* | ##   ## ###  ###   | */
+    0x63, 0xE3, 0x80, /* | ##   #####   ###   | */
+    0x61, 0xE3, 0x80, /* | ##    ####   ###   | */
+    0x61, 0xE3, 0x80, /* | ##    ####   ###   | */
+    0x60, 0xC3, 0x80, /* | ##     ##    ###   | */
+    0x60, 0x03, 0x80, /* | ##           ###   | */
+    0x60, 0x03, 0x80, /* | ##           ###   | */
+    0x60, 0x03, 0x80, /* | ##           ###   | */
+    0x60, 0x03, 0x80, /* | ##           ###   | */
+    0x60, 0x03, 0x80, /* | ##           ###   | */
+    0x60, 0x03, 0x80, /* | ##           ###   | */
+    0x60, 0x03, 0x80, /* | ##           ###   | */
+    0x60, 0x03, 0x80, /* | ##           ###   | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @4416 'N' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0xF8, 0x03, 0x80, /* |#####         ###   | */
+    0xF8, 0x03, 0x80, /* |#####         ###   | */
+    0xFC, 0x03, 0x80, /* |######        ###   | */
+    0xFC, 0x03, 0x80, /* |######        ###   | */
+    0xFE, 0x03, 0x80, /* |#######       ###   | */
+    0xFE, 0x03, 0x80, /* |#######       ###   | */
+    0xF7, 0x03, 0x80, /* |#### ###      ###   | */
+    0xF7, 0x03, 0x80, /* |#### ###      ###   | */
+    0xF3, 0x83, 0x80, /* |####  ###     ###   | */
+    0xF3, 0x83, 0x80, /* |####  ###     ###   | */
+    0xF1, 0xC3, 0x80, /* |####   ###    ###   | */
+    0xF1, 0xC3, 0x80, /* |####   ###    ###   | */
+    0xF0, 0xE3, 0x80, /* |####    ###   ###   | */
+    0xF0, 0xE3, 0x80, /* |####    ###   ###   | */
+    0xF0, 0x73, 0x80, /* |####     ###  ###   | */
+    0xF0, 0x73, 0x80, /* |####     ###  ###   | */
+    0xF0, 0x3B, 0x80, /* |####      ### ###   | */
+    0xF0, 0x3B, 0x80, /* |####      ### ###   | */
+    0xF0, 0x1F, 0x80, /* |####       ######   | */
+    0xF0, 0x1F, 0x80, /* |####       ######   | */
+    0xF0, 0x0F, 0x80, /* |####        #####   | */
+    0xF0, 0x0F, 0x80, /* |####        #####   | */
+    0xF0, 0x07, 0x80, /* |####         ####   | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @4512 'O' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x1E, 0x07, 0x00, /* |   ####      ###    | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x3C, 0x03, 0x80, /* |  ####        ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x3C, 0x03, 0x80, /* |  ####        ###   | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @4608 'P' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1F, 0xF8, 0x00, /* |   ##########       | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1C, 0x0F, 0x80, /* |   ###      #####   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0xC0, /* |   ###        ####  | */
+    0x1C, 0x03, 0xC0, /* |   ###        ####  | */
+    0x1C, 0x03, 0xC0, /* |   ###        ####  | */
+    0x1C, 0x03, 0xC0, /* |   ###        ####  | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x0F, 0x80, /* |   ###      #####   | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x1F, 0xF8, 0x00, /* |   ##########       | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @4704 'Q' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x1E, 0x07, 0x00, /* |   ####      ###    | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x3C, 0x03, 0x80, /* |  ####        ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x3C, 0x03, 0x80, /* |  ####        ###   | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x01, 0xFC, 0x00, /* |       #######      | */
+    0x00, 0x1C, 0x00, /* |           ###      | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+
+    // @4800 'R' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x3F, 0xF0, 0x00, /* |  ##########        | */
+    0x3F, 0xFC, 0x00, /* |  ############      | */
+    0x3F, 0xFE, 0x00, /* |  #############     | */
+    0x38, 0x1F, 0x00, /* |  ###      #####    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x80, /* |  ###        ####   | */
+    0x38, 0x07, 0x80, /* |  ###        ####   | */
+    0x38, 0x07, 0x80, /* |  ###        ####   | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x0F, 0x00, /* |  ###       ####    | */
+    0x3F, 0xFE, 0x00, /* |  #############     | */
+    0x3F, 0xF8, 0x00, /* |  ###########       | */
+    0x3F, 0xF8, 0x00, /* |  ###########       | */
+    0x38, 0x3C, 0x00, /* |  ###     ####      | */
+    0x38, 0x0E, 0x00, /* |  ###       ###     | */
+    0x38, 0x0F, 0x00, /* |  ###       ####    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x80, /* |  ###        ####   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0xC0, /* |  ###         ####  | */
+    0x38, 0x01, 0xC0, /* |  ###          ###  | */
+    0x38, 0x01, 0xE0, /* |  ###          #### | */
+    0x38, 0x00, 0xE0, /* |  ###           ### | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @4896 'S' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xFC, 0x00, /* |       #######      | */
+    0x07, 0xFF, 0x00, /* |     ###########    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x1E, 0x03, 0x00, /* |   ####       ##    | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x3C, 0x00, 0x00, /* |  ####              | */
+    0x1F, 0x00, 0x00, /* |   #####            | */
+    0x0F, 0xF0, 0x00, /* |    ########        | */
+    0x07, 0xFE, 0x00, /* |     ##########     | */
+    0x00, 0xFF, 0x00, /* |        ########    | */
+    0x00, 0x0F, 0x00, /* |            ####    | */
+    0x00, 0x07, 0x80, /* |             ####   | */
+    0x00, 0x03, 0x80, /* |              ###   | */
+    0x00, 0x03, 0x80, /* |              ###   | */
+    0x00, 0x03, 0x80, /* |              ###   | */
+    0x00, 0x07, 0x80, /* |             ####   | */
+    0x10, 0x0F, 0x80, /* |   #        #####   | */
+    0x3F, 0xFF, 0x00, /* |  ##############    | */
+    0x3F, 0xFE, 0x00, /* |  #############     | */
+    0x07, 0xF8, 0x00, /* |     ########       | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @4992 'T' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x7F, 0xFF, 0xE0, /* | ################## | */
+    0x7F, 0xFF, 0xE0, /* | ################## | */
+    0x7F, 0xFF, 0xE0, /* | ################## | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @5088 'U' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x3C, 0x03, 0x80, /* |  ####        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x1E, 0x0F, 0x00, /* |   ####     ####    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @5184 'V' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x70, 0x01, 0xC0, /* | ###           ###  | */
+    0x78, 0x01, 0xC0, /* | ####          ###  | */
+    0x38, 0x03, 0xC0, /* |  ###         ####  | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x0E, 0x07, 0x00, /* |    ###      ###    | */
+    0x0E, 0x0E, 0x00, /* |    ###     ###     | */
+    0x0E, 0x0E, 0x00, /* |    ###     ###     | */
+    0x07, 0x0E, 0x00, /* |     ###    ###     | */
+    0x07, 0x1C, 0x00, /* |     ###   ###      | */
+    0x07, 0x1C, 0x00, /* |     ###   ###      | */
+    0x07, 0x1C, 0x00, /* |     ###   ###      | */
+    0x03, 0x98, 0x00, /* |      ###  ##       | */
+    0x03, 0xB8, 0x00, /* |      ### ###       | */
+    0x03, 0xB8, 0x00, /* |      ### ###       | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @5280 'W' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0xE0, 0x00, 0xE0, /* |###             ### | */
+    0xE0, 0x00, 0xE0, /* |###             ### | */
+    0xE0, 0x00, 0xE0, /* |###             ### | */
+    0x60, 0x00, 0xE0, /* | ##             ### | */
+    0x70, 0x00, 0xE0, /* | ###            ### | */
+    0x70, 0x00, 0xC0, /* | ###            ##  | */
+    0x70, 0xE1, 0xC0, /* | ###    ###    ###  | */
+    0x70, 0xF1, 0xC0, /* | ###    ####   ###  | */
+    0x71, 0xF1, 0xC0, /* | ###   #####   ###  | */
+    0x71, 0xF1, 0xC0, /* | ###   #####   ###  | */
+    0x31, 0xB1, 0xC0, /* |  ##   ## ##   ###  | */
+    0x31, 0xB1, 0xC0, /* |  ##   ## ##   ###  | */
+    0x39, 0xB9, 0x80, /* |  ###  ## ###  ##   | */
+    0x3B, 0x99, 0x80, /* |  ### ###  ##  ##   | */
+    0x3B, 0x1B, 0x80, /* |  ### ##   ## ###   | */
+    0x3B, 0x1B, 0x80, /* |  ### ##   ## ###   | */
+    0x1B, 0x1B, 0x80, /* |   ## ##   ## ###   | */
+    0x1F, 0x0F, 0x80, /* |   #####    #####   | */
+    0x1E, 0x0F, 0x00, /* |   ####     ####    | */
+    0x1E, 0x0F, 0x00, /* |   ####     ####    | */
+    0x1E, 0x0F, 0x00, /* |   ####     ####    | */
+    0x1E, 0x0F, 0x00, /* |   ####     ####    | */
+    0x1E, 0x07, 0x00, /* |   ####      ###    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @5376 'X' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x38, 0x01, 0xC0, /* |  ###          ###  | */
+    0x3C, 0x03, 0x80, /* |  ####        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x0E, 0x07, 0x00, /* |    ###      ###    | */
+    0x0E, 0x0F, 0x00, /* |    ###     ####    | */
+    0x07, 0x0E, 0x00, /* |     ###    ###     | */
+    0x07, 0x9C, 0x00, /* |     ####  ###      | */
+    0x03, 0x9C, 0x00, /* |      ###  ###      | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x03, 0xF8, 0x00, /* |      #######       | */
+    0x03, 0x9C, 0x00, /* |      ###  ###      | */
+    0x07, 0x1C, 0x00, /* |     ###   ###      | */
+    0x0F, 0x0E, 0x00, /* |    ####    ###     | */
+    0x0E, 0x0F, 0x00, /* |    ###     ####    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x78, 0x01, 0xC0, /* | ####          ###  | */
+    0x70, 0x01, 0xE0, /* | ###           #### | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @5472 'Y' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x70, 0x01, 0xC0, /* | ###           ###  | */
+    0x78, 0x03, 0xC0, /* | ####         ####  | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x0E, 0x0E, 0x00, /* |    ###     ###     | */
+    0x0F, 0x0E, 0x00, /* |    ####    ###     | */
+    0x07, 0x1C, 0x00, /* |     ###   ###      | */
+    0x03, 0x9C, 0x00, /* |      ###  ###      | */
+    0x03, 0xB8, 0x00, /* |      ### ###       | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @5568 'Z' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1F, 0xFF, 0xC0, /* |   ###############  | */
+    0x1F, 0xFF, 0xC0, /* |   ###############  | */
+    0x1F, 0xFF, 0xC0, /* |   ###############  | */
+    0x00, 0x03, 0x80, /* |              ###   | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x1C, 0x00, /* |           ###      | */
+    0x00, 0x1C, 0x00, /* |           ###      | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x07, 0x00, 0x00, /* |     ###            | */
+    0x06, 0x00, 0x00, /* |     ##             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1F, 0xFF, 0xC0, /* |   ###############  | */
+    0x3F, 0xFF, 0xC0, /* |  ################  | */
+    0x3F, 0xFF, 0xC0, /* |  ################  | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @5664 '[' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x7E, 0x00, /* |         ######     | */
+    0x00, 0x7E, 0x00, /* |         ######     | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x7E, 0x00, /* |         ######     | */
+    0x00, 0x7E, 0x00, /* |         ######     | */
+
+    // @5760 '\' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x07, 0x00, 0x00, /* |     ###            | */
+    0x07, 0x00, 0x00, /* |     ###            | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x00, 0xC0, 0x00, /* |        ##          | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x1C, 0x00, /* |           ###      | */
+    0x00, 0x1C, 0x00, /* |           ###      | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x03, 0x80, /* |              ###   | */
+
+    // @5856 ']' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x07, 0xE0, 0x00, /* |     ######         | */
+    0x07, 0xE0, 0x00, /* |     ######         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x07, 0xE0, 0x00, /* |     ######         | */
+    0x07, 0xE0, 0x00, /* |     ######         | */
+
+    // @5952 '^' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x03, 0xF8, 0x00, /* |      #######       | */
+    0x07, 0xBC, 0x00, /* |     #### ####      | */
+    0x0F, 0x1E, 0x00, /* |    ####   ####     | */
+    0x0E, 0x0F, 0x00, /* |    ###     ####    | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x70, 0x01, 0xC0, /* | ###           ###  | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @6048 '_' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0xFF, 0xFF, 0xE0, /* |################### | */
+
+    // @6144 '`' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x07, 0x00, 0x00, /* |     ###            | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @6240 'a' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x03, 0xF0, 0x00, /* |      ######        | */
+    0x0F, 0xFC, 0x00, /* |    ##########      | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x1C, 0x0F, 0x00, /* |   ###      ####    | */
+    0x10, 0x07, 0x00, /* |   #         ###    | */
+    0x00, 0x03, 0x00, /* |              ##    | */
+    0x00, 0x03, 0x00, /* |              ##    | */
+    0x03, 0xFF, 0x80, /* |      ###########   | */
+    0x0F, 0xFF, 0x80, /* |    #############   | */
+    0x1F, 0xFF, 0x80, /* |   ##############   | */
+    0x3E, 0x03, 0x80, /* |  #####       ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x07, 0x80, /* |  ###        ####   | */
+    0x38, 0x07, 0x80, /* |  ###        ####   | */
+    0x3C, 0x1F, 0x80, /* |  ####     ######   | */
+    0x1F, 0xFB, 0x80, /* |   ########## ###   | */
+    0x0F, 0xF3, 0x80, /* |    ########  ###   | */
+    0x07, 0xC3, 0x80, /* |     #####    ###   | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @6336 'b' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0xF8, 0x00, /* |   ###  #####       | */
+    0x1D, 0xFE, 0x00, /* |   ### ########     | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x1E, 0x07, 0x80, /* |   ####      ####   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1E, 0x07, 0x80, /* |   ####      ####   | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1D, 0xFE, 0x00, /* |   ### ########     | */
+    0x1C, 0xF8, 0x00, /* |   ###  #####       | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @6432 'c' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0xFC, 0x00, /* |        ######      | */
+    0x03, 0xFF, 0x00, /* |      ##########    | */
+    0x07, 0xFF, 0x80, /* |     ############   | */
+    0x0F, 0x83, 0x80, /* |    #####     ###   | */
+    0x0F, 0x00, 0x00, /* |    ####            | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0F, 0x00, 0x00, /* |    ####            | */
+    0x0F, 0x83, 0x80, /* |    #####     ###   | */
+    0x07, 0xFF, 0x80, /* |     ############   | */
+    0x03, 0xFF, 0x00, /* |      ##########    | */
+    0x00, 0xFC, 0x00, /* |        ######      | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @6528 'd' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x03, 0xE7, 0x00, /* |      #####  ###    | */
+    0x07, 0xF7, 0x00, /* |     ####### ###    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x1E, 0x1F, 0x00, /* |   ####    #####    | */
+    0x1C, 0x0F, 0x00, /* |   ###      ####    | */
+    0x3C, 0x07, 0x00, /* |  ####       ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x3C, 0x07, 0x00, /* |  ####       ###    | */
+    0x1C, 0x0F, 0x00, /* |   ###      ####    | */
+    0x1E, 0x1F, 0x00, /* |   ####    #####    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x07, 0xF7, 0x00, /* |     ####### ###    | */
+    0x03, 0xE7, 0x00, /* |      #####  ###    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @6624 'e' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x07, 0xFE, 0x00, /* |     ##########     | */
+    0x0F, 0x0F, 0x00, /* |    ####    ####    | */
+    0x1E, 0x07, 0x00, /* |   ####      ###    | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x01, 0x80, /* |  ###          ##   | */
+    0x3F, 0xFF, 0x80, /* |  ###############   | */
+    0x3F, 0xFF, 0x80, /* |  ###############   | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x38, 0x00, 0x00, /* |  ###               | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1E, 0x00, 0x00, /* |   ####             | */
+    0x0F, 0x03, 0x80, /* |    ####      ###   | */
+    0x07, 0xFF, 0x80, /* |     ############   | */
+    0x01, 0xFE, 0x00, /* |       ########     | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @6720 'f' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x3F, 0x80, /* |          #######   | */
+    0x00, 0x7F, 0x80, /* |         ########   | */
+    0x00, 0xFF, 0x80, /* |        #########   | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x1F, 0xFF, 0x80, /* |   ##############   | */
+    0x1F, 0xFF, 0x80, /* |   ##############   | */
+    0x1F, 0xFF, 0x80, /* |   ##############   | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @6816 'g' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x03, 0xE7, 0x00, /* |      #####  ###    | */
+    0x07, 0xF7, 0x00, /* |     ####### ###    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x1E, 0x1F, 0x00, /* |   ####    #####    | */
+    0x1C, 0x0F, 0x00, /* |   ###      ####    | */
+    0x3C, 0x07, 0x00, /* |  ####       ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x3C, 0x07, 0x00, /* |  ####       ###    | */
+    0x1C, 0x0F, 0x00, /* |   ###      ####    | */
+    0x1E, 0x1F, 0x00, /* |   ####    #####    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x07, 0xF7, 0x00, /* |     ####### ###    | */
+    0x03, 0xE7, 0x00, /* |      #####  ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x0C, 0x1E, 0x00, /* |    ##     ####     | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+
+    // @6912 'h' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x78, 0x00, /* |   ###   ####       | */
+    0x1D, 0xFE, 0x00, /* |   ### ########     | */
+    0x1D, 0xFE, 0x00, /* |   ### ########     | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x1E, 0x07, 0x00, /* |   ####      ###    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @7008 'i' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x07, 0xF0, 0x00, /* |     #######        | */
+    0x07, 0xF0, 0x00, /* |     #######        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x0F, 0xFF, 0xC0, /* |    ##############  | */
+    0x0F, 0xFF, 0xC0, /* |    ##############  | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @7104 'j' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x0F, 0xF0, 0x00, /* |    ########        | */
+    0x0F, 0xF0, 0x00, /* |    ########        | */
+    0x0F, 0xF0, 0x00, /* |    ########        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x1F, 0xE0, 0x00, /* |   ########         | */
+
+    // @7200 'k' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0E, 0x03, 0x80, /* |    ###       ###   | */
+    0x0E, 0x07, 0x00, /* |    ###      ###    | */
+    0x0E, 0x0E, 0x00, /* |    ###     ###     | */
+    0x0E, 0x1C, 0x00, /* |    ###    ###      | */
+    0x0E, 0x38, 0x00, /* |    ###   ###       | */
+    0x0E, 0x70, 0x00, /* |    ###  ###        | */
+    0x0E, 0xE0, 0x00, /* |    ### ###         | */
+    0x0F, 0xE0, 0x00, /* |    #######         | */
+    0x0F, 0xF0, 0x00, /* |    ########        | */
+    0x0F, 0x78, 0x00, /* |    #### ####       | */
+    0x0E, 0x38, 0x00, /* |    ###   ###       | */
+    0x0E, 0x1C, 0x00, /* |    ###    ###      | */
+    0x0E, 0x1E, 0x00, /* |    ###    ####     | */
+    0x0E, 0x0F, 0x00, /* |    ###     ####    | */
+    0x0E, 0x07, 0x00, /* |    ###      ###    | */
+    0x0E, 0x03, 0x80, /* |    ###       ###   | */
+    0x0E, 0x03, 0xC0, /* |    ###       ####  | */
+    0x0E, 0x01, 0xC0, /* |    ###        ###  | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @7296 'l' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x0F, 0xE0, 0x00, /* |    #######         | */
+    0x0F, 0xE0, 0x00, /* |    #######         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x78, 0x00, /* |         ####       | */
+    0x00, 0x3F, 0x80, /* |          #######   | */
+    0x00, 0x1F, 0x80, /* |           ######   | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @7392 'm' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x33, 0x8F, 0x00, /* |  ##  ###   ####    | */
+    0x3F, 0xDF, 0x80, /* |  ######## ######   | */
+    0x3F, 0xFF, 0x80, /* |  ###############   | */
+    0x38, 0xF3, 0x80, /* |  ###   ####  ###   | */
+    0x38, 0xE1, 0xC0, /* |  ###   ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x30, 0xE1, 0xC0, /* |  ##    ###    ###  | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @7488 'n' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1C, 0x78, 0x00, /* |   ###   ####       | */
+    0x1D, 0xFE, 0x00, /* |   ### ########     | */
+    0x1D, 0xFE, 0x00, /* |   ### ########     | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x1E, 0x07, 0x00, /* |   ####      ###    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @7584 'o' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x1C, 0x07, 0x80, /* |   ###       ####   | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+    0x07, 0xFC, 0x00, /* |     #########      | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @7680 'p' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1C, 0xF8, 0x00, /* |   ###  #####       | */
+    0x1D, 0xFE, 0x00, /* |   ### ########     | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x1E, 0x07, 0x80, /* |   ####      ####   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1E, 0x07, 0x80, /* |   ####      ####   | */
+    0x1F, 0x0F, 0x00, /* |   #####    ####    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1D, 0xFE, 0x00, /* |   ### ########     | */
+    0x1C, 0xF8, 0x00, /* |   ###  #####       | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+
+    // @7776 'q' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x03, 0xE3, 0x00, /* |      #####   ##    | */
+    0x07, 0xF3, 0x00, /* |     #######  ##    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x1E, 0x1F, 0x00, /* |   ####    #####    | */
+    0x1C, 0x0F, 0x00, /* |   ###      ####    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x38, 0x03, 0x00, /* |  ###         ##    | */
+    0x38, 0x03, 0x00, /* |  ###         ##    | */
+    0x38, 0x03, 0x00, /* |  ###         ##    | */
+    0x38, 0x07, 0x00, /* |  ###        ###    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x0F, 0x00, /* |   ###      ####    | */
+    0x1E, 0x1F, 0x00, /* |   ####    #####    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x07, 0xF3, 0x00, /* |     #######  ##    | */
+    0x03, 0xE3, 0x00, /* |      #####   ##    | */
+    0x00, 0x03, 0x00, /* |              ##    | */
+    0x00, 0x03, 0x00, /* |              ##    | */
+    0x00, 0x03, 0x00, /* |              ##    | */
+    0x00, 0x03, 0x00, /* |              ##    | */
+    0x00, 0x03, 0x00, /* |              ##    | */
+
+    // @7872 'r' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x03, 0x8F, 0x80, /* |      ###   #####   | */
+    0x03, 0xBF, 0xC0, /* |      ### ########  | */
+    0x03, 0xFF, 0xC0, /* |      ############  | */
+    0x03, 0xF0, 0x40, /* |      ######     #  | */
+    0x03, 0xC0, 0x00, /* |      ####          | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @7968 's' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x07, 0xFE, 0x00, /* |     ##########     | */
+    0x0F, 0xFE, 0x00, /* |    ###########     | */
+    0x0E, 0x02, 0x00, /* |    ###       #     | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x1C, 0x00, 0x00, /* |   ###              | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x0F, 0xE0, 0x00, /* |    #######         | */
+    0x03, 0xFC, 0x00, /* |      ########      | */
+    0x00, 0x7E, 0x00, /* |         ######     | */
+    0x00, 0x0F, 0x00, /* |            ####    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x10, 0x07, 0x00, /* |   #         ###    | */
+    0x1C, 0x0F, 0x00, /* |   ###      ####    | */
+    0x1F, 0xFE, 0x00, /* |   ############     | */
+    0x0F, 0xFC, 0x00, /* |    ##########      | */
+    0x03, 0xF0, 0x00, /* |      ######        | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @8064 't' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x3F, 0xFF, 0x00, /* |  ##############    | */
+    0x3F, 0xFF, 0x00, /* |  ##############    | */
+    0x3F, 0xFF, 0x00, /* |  ##############    | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x01, 0xE0, 0x00, /* |       ####         | */
+    0x01, 0xFF, 0x00, /* |       #########    | */
+    0x00, 0xFF, 0x00, /* |        ########    | */
+    0x00, 0x3F, 0x00, /* |          ######    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @8160 'u' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1E, 0x0F, 0x00, /* |   ####     ####    | */
+    0x0E, 0x1F, 0x00, /* |    ###    #####    | */
+    0x0F, 0xFB, 0x00, /* |    ######### ##    | */
+    0x07, 0xF3, 0x00, /* |     #######  ##    | */
+    0x03, 0xE3, 0x00, /* |      #####   ##    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @8256 'v' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x38, 0x01, 0xC0, /* |  ###          ###  | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x1C, 0x03, 0x00, /* |   ###        ##    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x0E, 0x06, 0x00, /* |    ###      ##     | */
+    0x0E, 0x0E, 0x00, /* |    ###     ###     | */
+    0x0E, 0x0E, 0x00, /* |    ###     ###     | */
+    0x07, 0x0C, 0x00, /* |     ###    ##      | */
+    0x07, 0x1C, 0x00, /* |     ###   ###      | */
+    0x03, 0x1C, 0x00, /* |      ##   ###      | */
+    0x03, 0x98, 0x00, /* |      ###  ##       | */
+    0x03, 0xB8, 0x00, /* |      ### ###       | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @8352 'w' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0xE0, 0x00, 0xE0, /* |###             ### | */
+    0xE0, 0x00, 0xE0, /* |###             ### | */
+    0x60, 0x00, 0xE0, /* | ##             ### | */
+    0x70, 0x00, 0xC0, /* | ###            ##  | */
+    0x70, 0x01, 0xC0, /* | ###           ###  | */
+    0x70, 0xE1, 0xC0, /* | ###    ###    ###  | */
+    0x70, 0xE1, 0xC0, /* | ###    ###    ###  | */
+    0x30, 0xF1, 0xC0, /* |  ##    ####   ###  | */
+    0x39, 0xF1, 0x80, /* |  ###  #####   ##   | */
+    0x39, 0xB3, 0x80, /* |  ###  ## ##  ###   | */
+    0x39, 0xB3, 0x80, /* |  ###  ## ##  ###   | */
+    0x19, 0x9B, 0x80, /* |   ##  ##  ## ###   | */
+    0x1B, 0x1B, 0x00, /* |   ## ##   ## ##    | */
+    0x1F, 0x1F, 0x00, /* |   #####   #####    | */
+    0x1F, 0x1F, 0x00, /* |   #####   #####    | */
+    0x0F, 0x0F, 0x00, /* |    ####    ####    | */
+    0x0E, 0x0F, 0x00, /* |    ###     ####    | */
+    0x0E, 0x0E, 0x00, /* |    ###     ###     | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @8448 'x' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x0E, 0x0F, 0x00, /* |    ###     ####    | */
+    0x0E, 0x0E, 0x00, /* |    ###     ###     | */
+    0x07, 0x1C, 0x00, /* |     ###   ###      | */
+    0x03, 0xB8, 0x00, /* |      ### ###       | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x03, 0xB8, 0x00, /* |      ### ###       | */
+    0x07, 0x1C, 0x00, /* |     ###   ###      | */
+    0x0F, 0x0E, 0x00, /* |    ####    ###     | */
+    0x0E, 0x0F, 0x00, /* |    ###     ####    | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x3C, 0x03, 0x80, /* |  ####        ###   | */
+    0x38, 0x03, 0xC0, /* |  ###         ####  | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @8544 'y' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x38, 0x01, 0xC0, /* |  ###          ###  | */
+    0x38, 0x03, 0x80, /* |  ###         ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x03, 0x80, /* |   ###        ###   | */
+    0x1C, 0x07, 0x00, /* |   ###       ###    | */
+    0x0E, 0x07, 0x00, /* |    ###      ###    | */
+    0x0E, 0x07, 0x00, /* |    ###      ###    | */
+    0x06, 0x0E, 0x00, /* |     ##     ###     | */
+    0x07, 0x0E, 0x00, /* |     ###    ###     | */
+    0x07, 0x0C, 0x00, /* |     ###    ##      | */
+    0x03, 0x9C, 0x00, /* |      ###  ###      | */
+    0x03, 0x9C, 0x00, /* |      ###  ###      | */
+    0x03, 0xB8, 0x00, /* |      ### ###       | */
+    0x01, 0xF8, 0x00, /* |       ######       | */
+    0x01, 0xF0, 0x00, /* |       #####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x03, 0xC0, 0x00, /* |      ####          | */
+    0x1F, 0x80, 0x00, /* |   ######           | */
+
+    // @8640 'z' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x0F, 0xFF, 0x00, /* |    ############    | */
+    0x00, 0x07, 0x00, /* |             ###    | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x1C, 0x00, /* |           ###      | */
+    0x00, 0x38, 0x00, /* |          ###       | */
+    0x00, 0x30, 0x00, /* |          ##        | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x03, 0x80, 0x00, /* |      ###           | */
+    0x03, 0x00, 0x00, /* |      ##            | */
+    0x06, 0x00, 0x00, /* |     ##             | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x1F, 0xFF, 0x00, /* |   #############    | */
+    0x00, 0x00, 0x00, /* |                    | */
+
+    // @8736 '{' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x1F, 0x00, /* |           #####    | */
+    0x00, 0x3F, 0x00, /* |          ######    | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x60, 0x00, /* |         ##         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x1F, 0x80, 0x00, /* |   ######           | */
+    0x1F, 0x80, 0x00, /* |   ######           | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x3F, 0x00, /* |          ######    | */
+    0x00, 0x1F, 0x00, /* |           #####    | */
+
+    // @8832 '|' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+    0x00, 0x70, 0x00, /* |         ###        | */
+
+    // @8928 '}' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x1F, 0x00, 0x00, /* |   #####            | */
+    0x1F, 0xC0, 0x00, /* |   #######          | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0x78, 0x00, /* |         ####       | */
+    0x00, 0x1F, 0x80, /* |           ######   | */
+    0x00, 0x1F, 0x80, /* |           ######   | */
+    0x00, 0x78, 0x00, /* |         ####       | */
+    0x00, 0xF0, 0x00, /* |        ####        | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x00, 0xE0, 0x00, /* |        ###         | */
+    0x01, 0xC0, 0x00, /* |       ###          | */
+    0x1F, 0xC0, 0x00, /* |   #######          | */
+    0x1F, 0x00, 0x00, /* |   #####            | */
+
+    // @9024 '~' (20 pixels wide)
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x0E, 0x00, 0x00, /* |    ###             | */
+    0x1F, 0x80, 0x00, /* |   ######           | */
+    0x3F, 0x80, 0x00, /* |  #######           | */
+    0x71, 0xC0, 0x40, /* | ###   ###       #  | */
+    0x60, 0xE0, 0xE0, /* | ##     ###     ### | */
+    0xE0, 0xF0, 0xE0, /* |###     ####    ### | */
+    0x40, 0x79, 0xC0, /* | #       ####  ###  | */
+    0x00, 0x3F, 0x80, /* |          #######   | */
+    0x00, 0x1F, 0x80, /* |           ######   | */
+    0x00, 0x0E, 0x00, /* |            ###     | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+    0x00, 0x00, 0x00, /* |                    | */
+};
+
+sFONT Font32 = {
+    Font32_Table,
+    20, /* Width */
+    32, /* Height */
+};
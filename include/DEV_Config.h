@@ -62,6 +62,23 @@
 #endif
 
 
+/**
+ * SPI transport
+ * 1: ESP32 HSPI peripheral through the IDF spi_master driver with DMA,
+ *    CS and DC stay plain GPIOs driven by the EPD driver
+ * 0: bit-banged SCK/MOSI (original Waveshare transport)
+**/
+#define USE_HW_SPI          1
+#define DEV_SPI_CLOCK_HZ    10000000
+#define DEV_SPI_DMA_CHUNK   4092    // bytes per DMA transaction (one descriptor)
+
+/**
+ * BUSY line
+ * 1: the waiting task sleeps until a GPIO interrupt reports the level
+ * 0: poll every 20 ms
+**/
+#define USE_BUSY_IRQ        1
+
 #define GPIO_PIN_SET   1
 #define GPIO_PIN_RESET 0
 
@@ -81,7 +98,13 @@ UBYTE DEV_Module_Init(void);
 void GPIO_Mode(UWORD GPIO_Pin, UWORD Mode);
 void DEV_SPI_WriteByte(UBYTE data);
 UBYTE DEV_SPI_ReadByte();
-void DEV_SPI_Write_nByte(UBYTE *pData, UDOUBLE len);
+void DEV_SPI_Write_nByte(const UBYTE *pData, UDOUBLE len);
+void DEV_SPI_Stream_Write(const UBYTE *pData, UDOUBLE len, UBYTE Xor);
+void DEV_SPI_Stream_Fill(UBYTE Value, UDOUBLE len);
+void DEV_SPI_Stream_Flush(void);
+void DEV_Busy_Wait(UBYTE Level);
+void DEV_Busy_Notify(UBYTE Level, void (*Callback)(void));
+void DEV_Busy_LightSleep(UBYTE Level);
 void DEV_Module_Exit(void);
 
 #endif
@@ -37,8 +37,13 @@
 #define EPD_3IN52B_WIDTH       240
 #define EPD_3IN52B_HEIGHT      360 
 
-#define LUTGC_TEST          //
-#define LUTDU_TEST          //
+// Waveform of a refresh. The black/white ones come from registers (see
+// EPD_3IN52B_DisplayFastAsync()) and show red ink as black.
+typedef enum {
+    EPD_3IN52B_LUT_OTP = 0,  // Tri-color waveform from OTP, several seconds
+    EPD_3IN52B_LUT_GC,       // Black/white global clear, flashes once, ~0.9 s
+    EPD_3IN52B_LUT_DU,       // Black/white direct update, no flash, ~0.3 s
+} EPD_3IN52B_LUT;
 
 #define EPD_3IN52B_WHITE                         0xFF  // 
 #define EPD_3IN52B_BLACK                         0x00  //
@@ -54,10 +59,38 @@
 
 extern unsigned char EPD_3IN52B_Flag;
 
+// Planes of EPD_3IN52B_DisplayPlanesAsync() / EPD_3IN52B_DisplayWindowPlanesAsync()
+#define EPD_3IN52B_PLANE_BLACK                   0x01
+#define EPD_3IN52B_PLANE_RED                     0x02
+#define EPD_3IN52B_PLANE_ALL                     0x03
+
+// Refresh-finished callback, runs in interrupt context (see DEV_Busy_Notify)
+typedef void (*EPD_3IN52B_Callback)(void);
+
 void EPD_3IN52B_SendCommand(UBYTE Reg);
 void EPD_3IN52B_SendData(UBYTE Data);
+void EPD_3IN52B_SendDataBuffer(const UBYTE *pData, size_t Len);
 void EPD_3IN52B_Init(void);
 void EPD_3IN52B_Display(const UBYTE *blackimage, const UBYTE *ryimage);
+void EPD_3IN52B_DisplayWindow(UWORD x, UWORD y, UWORD w, UWORD h,
+                              const UBYTE *blackimage, const UBYTE *ryimage);
+void EPD_3IN52B_DisplayAsync(const UBYTE *blackimage, const UBYTE *ryimage,
+                             EPD_3IN52B_Callback Done);
+void EPD_3IN52B_DisplayWindowAsync(UWORD x, UWORD y, UWORD w, UWORD h,
+                                   const UBYTE *blackimage, const UBYTE *ryimage,
+                                   EPD_3IN52B_Callback Done);
+void EPD_3IN52B_DisplayPlanesAsync(const UBYTE *blackimage, const UBYTE *ryimage, UBYTE Changed,
+                                   EPD_3IN52B_Callback Done);
+void EPD_3IN52B_DisplayWindowPlanesAsync(UWORD x, UWORD y, UWORD w, UWORD h,
+                                         const UBYTE *blackimage, const UBYTE *ryimage, UBYTE Changed,
+                                         EPD_3IN52B_Callback Done);
+void EPD_3IN52B_DisplayFastAsync(const UBYTE *oldblack, const UBYTE *oldry,
+                                 const UBYTE *blackimage, const UBYTE *ryimage,
+                                 EPD_3IN52B_LUT Lut, EPD_3IN52B_Callback Done);
+UDOUBLE EPD_3IN52B_TakeBytesSent(void);
+UBYTE EPD_3IN52B_IsBusy(void);
+void EPD_3IN52B_WaitIdle(void);
+void EPD_3IN52B_SleepUntilIdle(void);
 void EPD_3IN52B_Display_NUM(const UBYTE *image,UBYTE NUM);
 void EPD_3IN52B_Clear(void);
 void EPD_3IN52B_sleep(void);
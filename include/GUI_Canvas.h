@@ -0,0 +1,278 @@
+/******************************************************************************
+* | File      	:   GUI_Canvas.h
+* | Function    :   Paint context with rotation, mirroring and scale fixed at
+*                   compile time
+* | Info        :
+*   Canvas<Rotate, Mirror, Scale> draws into the global Paint (the selected
+*   image and its dirty region) exactly like the Paint_* functions do, but
+*   the screen-to-memory mapping and the pixel store are resolved by the
+*   compiler, so a pixel write is a handful of shifts and masks.
+*
+*   The Paint_* API dispatches to Canvas_Rotate90 whenever Paint matches it
+*   (the clock's configuration); other combinations keep the runtime path.
+*   Callers may also use a Canvas directly once Matches() holds.
+******************************************************************************/
+#ifndef __GUI_CANVAS_H
+#define __GUI_CANVAS_H
+
+#include "GUI_Paint.h"
+#include <stdint.h>
+#include <string.h>
+
+/******************************************************************************
+function: Grow the dirty region to cover a memory-coordinate pixel
+******************************************************************************/
+static inline void Paint_MarkDirty(UWORD X, UWORD Y)
+{
+    if (X < Paint.DirtyXstart) Paint.DirtyXstart = X;
+    if (X >= Paint.DirtyXend) Paint.DirtyXend = X + 1;
+    if (Y < Paint.DirtyYstart) Paint.DirtyYstart = Y;
+    if (Y >= Paint.DirtyYend) Paint.DirtyYend = Y + 1;
+}
+
+static inline void Paint_MarkAllDirty(void)
+{
+    Paint.DirtyXstart = 0;
+    Paint.DirtyYstart = 0;
+    Paint.DirtyXend = Paint.WidthMemory;
+    Paint.DirtyYend = Paint.HeightMemory;
+}
+
+/******************************************************************************
+function: Fill Count bytes, nonzero if any of them changed
+info: Aligned 32-bit loads and stores between the unaligned ends
+******************************************************************************/
+static inline UBYTE Paint_FillBytes(UBYTE *Bytes, UDOUBLE Count, UBYTE Fill)
+{
+    uint32_t Word = Fill * 0x01010101UL, Diff = 0;
+    UDOUBLE i = 0;
+    for (; i < Count && ((uintptr_t)(Bytes + i) & 3); i++) {
+        Diff |= Bytes[i] ^ Fill;
+        Bytes[i] = Fill;
+    }
+    for (; i + 4 <= Count; i += 4) {
+        uint32_t Value;
+        memcpy(&Value, Bytes + i, 4);
+        Diff |= Value ^ Word;
+        memcpy(Bytes + i, &Word, 4);
+    }
+    for (; i < Count; i++) {
+        Diff |= Bytes[i] ^ Fill;
+        Bytes[i] = Fill;
+    }
+    return Diff != 0;
+}
+
+static inline void Paint_InvertBytes(UBYTE *Bytes, UDOUBLE Count)
+{
+    UDOUBLE i = 0;
+    for (; i < Count && ((uintptr_t)(Bytes + i) & 3); i++)
+        Bytes[i] = ~Bytes[i];
+    for (; i + 4 <= Count; i += 4) {
+        uint32_t Value;
+        memcpy(&Value, Bytes + i, 4);
+        Value = ~Value;
+        memcpy(Bytes + i, &Value, 4);
+    }
+    for (; i < Count; i++)
+        Bytes[i] = ~Bytes[i];
+}
+
+/******************************************************************************
+function: Fill or invert a rectangle of a 1-bit image in memory coordinates
+parameter:
+    X0, Y0, X1, Y1 : Inclusive bounds, inside the image
+    Color          : Fill color, ignored when inverting
+    Invert         : Flip the bits instead
+info:
+    Each memory row is a masked byte at both ends and whole bytes between;
+    a rectangle of whole rows is a single run. Rows that already had the
+    color stay out of the dirty region.
+******************************************************************************/
+static inline void Paint_FillMemory(UWORD X0, UWORD Y0, UWORD X1, UWORD Y1, UWORD Color, UBYTE Invert)
+{
+    UBYTE *Image = Paint.Image;
+    UWORD WidthByte = Paint.WidthByte;
+    UWORD First = X0 / 8, Last = X1 / 8;
+    UBYTE First_Mask = 0xFF >> (X0 % 8);
+    UBYTE Last_Mask = 0xFF << (7 - X1 % 8);
+    UBYTE Fill = (Color == BLACK) ? 0x00 : 0xFF;
+    if (First == Last)
+        First_Mask &= Last_Mask;
+
+    if (First == 0 && Last == WidthByte - 1 && First_Mask == 0xFF && Last_Mask == 0xFF) {
+        UBYTE *Start = Image + (UDOUBLE)Y0 * WidthByte;
+        UDOUBLE Count = (UDOUBLE)(Y1 - Y0 + 1) * WidthByte;
+        if (Invert)
+            Paint_InvertBytes(Start, Count);
+        else if (!Paint_FillBytes(Start, Count, Fill))
+            return;
+        Paint_MarkDirty(X0, Y0);
+        Paint_MarkDirty(X1, Y1);
+        return;
+    }
+
+    UWORD Dirty_Start = 0xFFFF, Dirty_End = 0;
+    for (UWORD Y = Y0; Y <= Y1; Y++) {
+        UBYTE *Row = Image + (UDOUBLE)Y * WidthByte;
+        UBYTE Changed = 1;
+        if (Invert) {
+            Row[First] ^= First_Mask;
+            if (Last != First) {
+                Paint_InvertBytes(Row + First + 1, Last - First - 1);
+                Row[Last] ^= Last_Mask;
+            }
+        } else {
+            UBYTE Value = (Row[First] & ~First_Mask) | (Fill & First_Mask);
+            Changed = Value ^ Row[First];
+            Row[First] = Value;
+            if (Last != First) {
+                Changed |= Paint_FillBytes(Row + First + 1, Last - First - 1, Fill);
+                Value = (Row[Last] & ~Last_Mask) | (Fill & Last_Mask);
+                Changed |= Value ^ Row[Last];
+                Row[Last] = Value;
+            }
+        }
+        if (Changed) {
+            if (Y < Dirty_Start) Dirty_Start = Y;
+            Dirty_End = Y;
+        }
+    }
+    if (Dirty_Start <= Dirty_End) {
+        Paint_MarkDirty(X0, Dirty_Start);
+        Paint_MarkDirty(X1, Dirty_End);
+    }
+}
+
+template <UWORD Rotate, MIRROR_IMAGE Mirror, UBYTE Scale>
+struct Canvas {
+    static_assert(Rotate == ROTATE_0 || Rotate == ROTATE_90 || Rotate == ROTATE_180 || Rotate == ROTATE_270,
+                  "Canvas rotation must be 0, 90, 180 or 270");
+    static_assert(Scale == 2 || Scale == 4 || Scale == 6 || Scale == 7 || Scale == 16,
+                  "Canvas scale must be one Paint_SetScale() accepts");
+
+    // Whether the selected image is set up the way this canvas assumes
+    static inline bool Matches(void)
+    {
+        return Paint.Rotate == Rotate && Paint.Mirror == Mirror && Paint.Scale == Scale;
+    }
+
+    // Screen to memory coordinates, false if the point is outside the image
+    static inline bool Map(UWORD Xpoint, UWORD Ypoint, UWORD &X, UWORD &Y)
+    {
+        if (Xpoint >= Paint.Width || Ypoint >= Paint.Height)
+            return false;
+
+        if (Rotate == ROTATE_0) {
+            X = Xpoint;
+            Y = Ypoint;
+        } else if (Rotate == ROTATE_90) {
+            X = Paint.WidthMemory - Ypoint - 1;
+            Y = Xpoint;
+        } else if (Rotate == ROTATE_180) {
+            X = Paint.WidthMemory - Xpoint - 1;
+            Y = Paint.HeightMemory - Ypoint - 1;
+        } else {
+            X = Ypoint;
+            Y = Paint.HeightMemory - Xpoint - 1;
+        }
+
+        if (Mirror == MIRROR_HORIZONTAL || Mirror == MIRROR_ORIGIN)
+            X = Paint.WidthMemory - X - 1;
+        if (Mirror == MIRROR_VERTICAL || Mirror == MIRROR_ORIGIN)
+            Y = Paint.HeightMemory - Y - 1;
+        return true;
+    }
+
+    // Screen rectangle (end exclusive, clipped to the image) to inclusive
+    // memory bounds, false if nothing is left of it
+    static inline bool MapWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                                 UWORD &X0, UWORD &Y0, UWORD &X1, UWORD &Y1)
+    {
+        if (Xend > Paint.Width) Xend = Paint.Width;
+        if (Yend > Paint.Height) Yend = Paint.Height;
+        UWORD Xa, Ya, Xb, Yb;
+        if (Xstart >= Xend || Ystart >= Yend ||
+            !Map(Xstart, Ystart, Xa, Ya) || !Map(Xend - 1, Yend - 1, Xb, Yb))
+            return false;
+        X0 = Xa < Xb ? Xa : Xb;
+        X1 = Xa < Xb ? Xb : Xa;
+        Y0 = Ya < Yb ? Ya : Yb;
+        Y1 = Ya < Yb ? Yb : Ya;
+        return true;
+    }
+
+    // Write one pixel at memory coordinates (no bounds check)
+    static inline void Store(UWORD X, UWORD Y, UWORD Color)
+    {
+        if (Scale == 2) {
+            UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
+            if (Color == BLACK)
+                Paint.Image[Addr] &= ~(0x80 >> (X % 8));
+            else
+                Paint.Image[Addr] |= 0x80 >> (X % 8);
+        } else if (Scale == 4) {
+            UDOUBLE Addr = X / 4 + Y * Paint.WidthByte;
+            Color = Color % 4;//Guaranteed color scale is 4  --- 0~3
+            UBYTE Rdata = Paint.Image[Addr] & ~(0xC0 >> ((X % 4) * 2));
+            Paint.Image[Addr] = Rdata | ((Color << 6) >> ((X % 4) * 2));
+        } else {
+            UDOUBLE Addr = X / 2 + Y * Paint.WidthByte;
+            UBYTE Rdata = Paint.Image[Addr] & ~(0xF0 >> ((X % 2) * 4));//Clear first, then set value
+            Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2) * 4));
+        }
+    }
+
+    static inline void SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+    {
+        UWORD X, Y;
+        if (!Map(Xpoint, Ypoint, X, Y)) {
+            Debug("Exceeding display boundaries\r\n");
+            return;
+        }
+        Paint_MarkDirty(X, Y);
+        Store(X, Y, Color);
+    }
+
+    static inline void Clear(UWORD Color)
+    {
+        UBYTE Fill;
+        if (Scale == 2)
+            Fill = Color;
+        else if (Scale == 4)
+            Fill = (Color << 6) | (Color << 4) | (Color << 2) | Color;
+        else
+            Fill = (Color << 4) | Color;
+
+        Paint_MarkAllDirty();
+        memset(Paint.Image, Fill, (UDOUBLE)Paint.WidthByte * Paint.HeightByte);
+    }
+
+    static inline void ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+    {
+        if (Scale == 2) {
+            UWORD X0, Y0, X1, Y1;
+            if (MapWindow(Xstart, Ystart, Xend, Yend, X0, Y0, X1, Y1))
+                Paint_FillMemory(X0, Y0, X1, Y1, Color, 0);
+            return;
+        }
+
+        for (UWORD Y = Ystart; Y < Yend; Y++)
+            for (UWORD X = Xstart; X < Xend; X++)
+                SetPixel(X, Y, Color);
+    }
+
+    // Flip every pixel of the rectangle (1-bit images only)
+    static inline void InvertWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+    {
+        static_assert(Scale == 2, "Canvas inversion needs a 1-bit image");
+        UWORD X0, Y0, X1, Y1;
+        if (MapWindow(Xstart, Ystart, Xend, Yend, X0, Y0, X1, Y1))
+            Paint_FillMemory(X0, Y0, X1, Y1, WHITE, 1);
+    }
+};
+
+// The configuration main.cpp draws both planes with
+typedef Canvas<ROTATE_90, MIRROR_NONE, 2> Canvas_Rotate90;
+
+#endif
@@ -97,9 +97,65 @@ typedef struct {
     UWORD WidthByte;
     UWORD HeightByte;
     UWORD Scale;
+    UWORD DirtyXstart;  // Bounding box of touched pixels in memory coordinates,
+    UWORD DirtyYstart;  // end exclusive, empty when DirtyXstart >= DirtyXend.
+    UWORD DirtyXend;    // Shared by every image drawn through Paint, so it
+    UWORD DirtyYend;    // spans all planes touched since Paint_ResetDirty()
 } PAINT;
 extern PAINT Paint;
 
+/**
+ * Rectangle in memory coordinates, end exclusive
+**/
+typedef struct {
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Xend;
+    UWORD Yend;
+} PAINT_RECT;
+
+/**
+ * Word-wrapped text layout, see Paint_MeasureText()
+ * Lines point into the measured string, which must outlive the layout
+**/
+#define PAINT_LAYOUT_MAX_LINES  32
+
+typedef struct {
+    const char *Start;      // First character of the line
+    UWORD Length;           // Characters to draw, interior spaces included
+} PAINT_LINE;
+
+typedef struct {
+    sFONT *Font;
+    UWORD LineHeight;       // Font->Height + line spacing
+    UWORD Width;            // Widest line in pixels
+    UWORD Height;           // Top of the first line to bottom of the last
+    UWORD LineCount;
+    UBYTE Truncated;        // Text did not fit, Lines hold what did
+    PAINT_LINE Lines[PAINT_LAYOUT_MAX_LINES];
+} PAINT_LAYOUT;
+
+/**
+ * Pre-rotated glyphs for stamping a short string (the clock's "HH:MM") into a
+ * ROTATE_90 1-bit image with byte stores, see Paint_SpritesInit()
+**/
+#define PAINT_SPRITES_MAX_CHARS 12
+#define PAINT_SPRITES_MAX_WIDTH 32
+#define PAINT_SPRITES_MAX_BYTES 5   // Bytes a column of 32 rows can touch
+
+typedef struct {
+    sFONT *Font;                    // NULL until Paint_SpritesInit() succeeded
+    char Chars[PAINT_SPRITES_MAX_CHARS + 1];
+    UWORD Ypoint;                   // Screen row the cells start at
+    UWORD Color_Foreground;
+    UWORD Color_Background;
+    UWORD WidthMemory;              // Image geometry the cells were built for
+    UWORD ByteStart;                // First byte of a cell column in a memory row
+    UBYTE Bytes;                    // Bytes per cell column
+    UBYTE Area[PAINT_SPRITES_MAX_BYTES];  // Bits of those bytes inside the cell
+    UBYTE Cells[PAINT_SPRITES_MAX_CHARS][PAINT_SPRITES_MAX_WIDTH][PAINT_SPRITES_MAX_BYTES];
+} PAINT_SPRITES;
+
 /**
  * Display rotate
 **/
@@ -201,6 +257,12 @@ void Paint_SetScale(UBYTE scale);
 
 void Paint_Clear(UWORD Color);
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void Paint_InvertWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+
+//Dirty region
+void Paint_ResetDirty(void);
+UBYTE Paint_GetDirtyRect(PAINT_RECT *Rect);
+UBYTE Paint_DiffRect(const UBYTE *image, const UBYTE *previous, PAINT_RECT *Rect);
 
 //Drawing
 void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay);
@@ -212,6 +274,11 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color,
 void Paint_DrawChar(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawString_EN_WordWrap(UWORD Xstart, UWORD Ystart, const char *pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background, UWORD lineSpacing);
+UBYTE Paint_MeasureText(const char *pString, sFONT* Font, UWORD MaxWidth, UWORD MaxHeight, UWORD lineSpacing, PAINT_LAYOUT *Layout);
+sFONT *Paint_FitText(const char *pString, sFONT **Fonts, UBYTE FontCount, UWORD MaxWidth, UWORD MaxHeight, UWORD lineSpacing, PAINT_LAYOUT *Layout);
+void Paint_DrawLayout(UWORD Xstart, UWORD Ystart, const PAINT_LAYOUT *Layout, UWORD Color_Foreground, UWORD Color_Background);
+UBYTE Paint_SpritesInit(PAINT_SPRITES *Sprites, sFONT* Font, const char *Chars, UWORD Ypoint, UWORD Color_Foreground, UWORD Color_Background);
+UBYTE Paint_SpritesStamp(const PAINT_SPRITES *Sprites, UWORD Xstart, const char *pString);
 void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
@@ -0,0 +1,113 @@
+/******************************************************************************
+* | File      	:   Perf.h
+* | Function    :   Phase timers for the awake time of the clock
+* | Info        :
+*   Each phase keeps count, min/avg/max and a log2 histogram in RTC memory,
+*   so the numbers survive deep sleep. Time a phase with a PerfScope on the
+*   stack, print everything with Perf_Report(). The bytes uploaded per frame
+*   are kept the same way.
+*
+*   For telemetry every awake cycle (a deep-sleep wake, a minute in loop
+*   mode) is also closed into a record with its awake time, the time of each
+*   phase, its refreshes and the battery voltage. Up to PERF_CYCLE_SLOTS of
+*   them and the totals since the last upload wait in RTC memory.
+******************************************************************************/
+#ifndef __PERF_H
+#define __PERF_H
+
+#include <stdint.h>
+#include <esp_timer.h>
+
+typedef enum {
+    PERF_VERSE_LOOKUP = 0,  // getCurrentVerseData(), index or JSON
+    PERF_JSON_PARSE,        // deserializeJson() of one hour file
+    PERF_RENDER,            // Drawing both planes
+    PERF_UPLOAD,            // SPI transfer of the planes
+    PERF_BUSY,              // Waiting for the panel refresh
+    PERF_WIFI,              // initWiFi()
+    PERF_NTP,               // syncTime()
+    PERF_POST,              // Telemetry upload
+    PERF_PHASE_COUNT
+} PERF_PHASE;
+
+typedef enum {
+    PERF_REFRESH_NONE = 0,  // Frame unchanged, panel not touched
+    PERF_REFRESH_FULL,
+    PERF_REFRESH_WINDOW,
+    PERF_REFRESH_FAST,
+    PERF_REFRESH_COUNT
+} PERF_REFRESH;
+
+// Bin 0 is < 1 ms, bin i counts [2^(i-1), 2^i) ms, the last one everything above
+#define PERF_HISTOGRAM_BINS 16
+
+typedef struct {
+    uint32_t Count;
+    uint32_t MinUs;
+    uint32_t MaxUs;
+    uint64_t TotalUs;
+    uint16_t Histogram[PERF_HISTOGRAM_BINS];
+} PERF_STATS;
+
+// Plane bytes sent to the panel per displayed frame
+typedef struct {
+    uint32_t Frames;
+    uint32_t MinBytes;
+    uint32_t MaxBytes;
+    uint64_t TotalBytes;
+} PERF_UPLOAD_STATS;
+
+// One awake cycle
+typedef struct {
+    uint32_t Time;                          // Epoch seconds at its end
+    uint32_t AwakeMs;                       // Since the previous cycle or boot
+    uint16_t PhaseMs[PERF_PHASE_COUNT];     // Saturated at 65535
+    uint16_t BatteryMv;                     // 0 = not measured
+    uint8_t Refreshes[PERF_REFRESH_COUNT];
+} PERF_CYCLE;
+
+#define PERF_CYCLE_SLOTS 60
+
+// Sums over all cycles since the last upload, also the ones the ring dropped
+typedef struct {
+    uint32_t Cycles;
+    uint32_t Dropped;                       // Overwritten before an upload
+    uint64_t AwakeMs;
+    uint64_t PhaseMs[PERF_PHASE_COUNT];
+    uint32_t Refreshes[PERF_REFRESH_COUNT];
+    uint16_t BatteryMinMv;                  // 0 = not measured
+} PERF_TELEMETRY;
+
+void Perf_Record(PERF_PHASE Phase, uint32_t Us);
+void Perf_RecordUploadBytes(uint32_t Bytes);
+// Live counters, other tasks may update them while they are read
+const PERF_UPLOAD_STATS *Perf_GetUpload(void);
+const PERF_STATS *Perf_Get(PERF_PHASE Phase);
+const char *Perf_PhaseName(PERF_PHASE Phase);
+const char *Perf_RefreshName(PERF_REFRESH Type);
+void Perf_RecordRefresh(PERF_REFRESH Type);
+// Close the current cycle into the ring (the oldest goes when it is full)
+void Perf_EndCycle(uint32_t Time, uint16_t BatteryMv);
+// Copy the totals and up to Max cycles (oldest first) for an upload, returns
+// the number of cycles copied
+uint16_t Perf_SnapshotTelemetry(PERF_TELEMETRY *Totals, PERF_CYCLE *Cycles, uint16_t Max);
+// After the upload of a snapshot: drop what it held, keep cycles closed since
+void Perf_TelemetrySent(const PERF_TELEMETRY *Totals, uint16_t Cycles);
+// Counters of the timing report only, the telemetry is kept
+void Perf_Reset(void);
+// Table of all phases on Serial
+void Perf_Report(void);
+// 'p' on Serial prints the report, 'r' resets the counters
+void Perf_PollSerial(void);
+
+class PerfScope {
+public:
+    explicit PerfScope(PERF_PHASE Phase) : phase(Phase), start(esp_timer_get_time()) {}
+    ~PerfScope() { Perf_Record(phase, (uint32_t)(esp_timer_get_time() - start)); }
+
+private:
+    PERF_PHASE phase;
+    int64_t start;
+};
+
+#endif
@@ -0,0 +1,31 @@
+/******************************************************************************
+* | File      	:   VerseRender.h
+* | Function    :   Layout of the clock face (time, book, verse)
+* | Info        :
+*   Shared by the firmware and the host tools (tools/prerender), so a frame
+*   rendered on the host is bit-identical to one drawn on the device.
+*   Both planes must have been set up with Paint_NewImage(..., ROTATE_90, WHITE).
+******************************************************************************/
+#ifndef __VERSE_RENDER_H
+#define __VERSE_RENDER_H
+
+#include <stddef.h>
+#include "GUI_Paint.h"
+#include "EPD_3in52b.h"
+
+// Display Dimensions (Adjust based on your e-Paper display)
+#define VERSE_DISPLAY_WIDTH     (EPD_3IN52B_HEIGHT - 5)  // Leave 5 pixels free on the right
+#define VERSE_DISPLAY_HEIGHT    EPD_3IN52B_WIDTH
+
+// "(Book 1:2)" -> "[Book 1:2]", empty if the reference has no parentheses.
+// Returns the length written to BookName.
+size_t VerseRender_BookName(const char *Reference, char *BookName, size_t Len);
+
+// Red plane: time on top, book name below it (BookName may be empty)
+void VerseRender_Header(UBYTE *Red, const char *TimeStr, const char *BookName);
+// Black plane: the word-wrapped verse in the largest font it fits in
+void VerseRender_Verse(UBYTE *Black, const char *VerseText, bool HasBookName);
+// Both planes
+void VerseRender_Frame(UBYTE *Black, UBYTE *Red, const char *TimeStr, const char *BookName, const char *VerseText);
+
+#endif
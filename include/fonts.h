@@ -57,6 +57,12 @@ typedef struct _tFont
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+
+  // Column-span glyphs compiled by tools/fontc/fontc.py, NULL = bitmap table
+  const uint8_t *Spans;
+  const uint16_t *SpanIndex;  // Offset of each glyph in Spans
+  uint8_t FirstChar;          // Character of SpanIndex[0]
+  uint8_t CharCount;
   
 } sFONT;
 
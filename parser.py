@@ -21,21 +21,36 @@ We preserve:
 - Parentheses ( ) in references when bible verse is chosen.
 - Apostrophes '.
 - The verse text starts uppercase and ends with '.' or '...'.
-- TQDM progress bars for hours/minutes.
+- TQDM progress bar for the minutes.
 No "GPTGenerated" reference is ever used.
+
+The minutes are built by a pool of worker threads (--workers). Every GPT
+reply is cached on disk (--cache), keyed by translation, slot and candidate
+set, and each hour file is written as soon as its 60 minutes are done, so an
+interrupted build picks up where it stopped and a repeated one costs no GPT
+calls. Candidates are sampled with a per-slot seed, so a rerun asks for the
+same candidate sets.
+
+Next to the JSON files a compact binary index (data/verses.bin) is written
+for the firmware, see write_verse_index(). It can also be rebuilt from
+existing JSON files without any GPT calls:
+    python parser.py index data
+Data folders of several translations can be combined into one verse pack
+for the firmware's "verses" partition, see write_verse_pack():
+    python parser.py pack verses.bin esv=data luther=data_luther
 """
 
+import argparse
+import hashlib
 import json
 import random
 import os
+import pickle
 import re
-from openai import OpenAI
-from tqdm import tqdm  # pip install tqdm
-
-openai_api_key = os.getenv("OPENAI_API_KEY", "")
-if not openai_api_key:
-    print("Warning: No OPENAI_API_KEY found. Please set env var or hardcode for testing.")
-client = OpenAI(api_key=openai_api_key)
+import struct
+import threading
+import zlib
+from concurrent.futures import ThreadPoolExecutor, as_completed
 
 # -----------------------------------------------------------------------------
 # 1) parse_jadenzaleski_bible (GitHub/jadenzaleski/BibleTranslations)
@@ -70,24 +85,131 @@ def parse_jadenzaleski_bible(json_data):
                 })
     return verses_list
 
+# -----------------------------------------------------------------------------
+# 1b) Candidate index: (chapter, verse) -> verses, cached next to the Bible JSON
+# -----------------------------------------------------------------------------
+
+CANDIDATE_INDEX_VERSION = 1
+
+def build_candidate_index(bible_format, data):
+    """
+    Group the verses of a parsed Bible JSON by (chapter, verse) in one pass.
+    Only the slots of the clock are kept (chapter 1..24, verse 1..59), each
+    verse as {"book_name": ..., "text": ...}.
+    """
+    if bible_format == "biblesupersearch":
+        all_verses = data["verses"]  # e.g. {"metadata":{...}, "verses":[...]}
+    elif bible_format == "jadenzaleski":
+        all_verses = parse_jadenzaleski_bible(data)
+    else:
+        raise ValueError(f"Unknown format: {bible_format}")
+
+    chap_verse_map = {}
+    for v in all_verses:
+        key = (int(v["chapter"]), int(v["verse"]))
+        if 1 <= key[0] <= 24 and 1 <= key[1] <= 59:
+            chap_verse_map.setdefault(key, []).append(
+                {"book_name": v["book_name"], "text": v["text"]})
+    return chap_verse_map
+
+def load_candidate_index(bible_format, bible_json_file):
+    """
+    build_candidate_index() of a Bible JSON file, from <file>.candidates.pickle
+    when that was built from the same format, file size and mtime.
+    """
+    stat = os.stat(bible_json_file)
+    stamp = [CANDIDATE_INDEX_VERSION, bible_format, stat.st_size, stat.st_mtime_ns]
+    cache_file = bible_json_file + ".candidates.pickle"
+    try:
+        with open(cache_file, "rb") as f:
+            cached = pickle.load(f)
+        if cached["stamp"] == stamp:
+            return cached["index"]
+    except (OSError, pickle.UnpicklingError, EOFError, KeyError, TypeError):
+        pass
+
+    with open(bible_json_file, "r", encoding="utf-8") as f:
+        data = json.load(f)
+    chap_verse_map = build_candidate_index(bible_format, data)
+    try:
+        with open(cache_file + ".tmp", "wb") as f:
+            pickle.dump({"stamp": stamp, "index": chap_verse_map}, f, pickle.HIGHEST_PROTOCOL)
+        os.replace(cache_file + ".tmp", cache_file)
+    except OSError as e:
+        print(f"[WARN] Could not cache the candidate index: {e}")
+    return chap_verse_map
+
 # -----------------------------------------------------------------------------
 # 2) GPT Utility
 # -----------------------------------------------------------------------------
 
+class ResponseCache:
+    """
+    GPT replies on disk, one small JSON file per key (a JSON-serializable
+    list). Only successful replies are stored; a missing folder disables it.
+    """
+    def __init__(self, folder=None):
+        self.folder = folder
+        if folder:
+            os.makedirs(folder, exist_ok=True)
+
+    def _path(self, key):
+        digest = hashlib.sha256(json.dumps(key, ensure_ascii=False).encode("utf-8")).hexdigest()
+        return os.path.join(self.folder, digest + ".json")
+
+    def get(self, key):
+        if not self.folder:
+            return None
+        try:
+            with open(self._path(key), "r", encoding="utf-8") as f:
+                return json.load(f)["reply"]
+        except (OSError, ValueError, KeyError):
+            return None
+
+    def put(self, key, reply):
+        if not self.folder:
+            return
+        path = self._path(key)
+        tmp_path = f"{path}.{threading.get_ident()}.tmp"
+        with open(tmp_path, "w", encoding="utf-8") as f:
+            json.dump({"key": key, "reply": reply}, f, ensure_ascii=False)
+        os.replace(tmp_path, path)
+
+client = None  # OpenAI client, set up by main() for a build only
+response_cache = ResponseCache()  # Set up by main()
+
+def chat_completion(cache_key, **request):
+    """
+    client.chat.completions.create() returning the stripped reply, served
+    from response_cache when it has one for (model, *cache_key).
+    Exceptions of the request are passed on and nothing is cached.
+    """
+    key = [request["model"]] + list(cache_key)
+    reply = response_cache.get(key)
+    if reply is None:
+        response = client.chat.completions.create(**request)
+        reply = response.choices[0].message.content.strip()
+        response_cache.put(key, reply)
+    return reply
+
 recent_statements = []  # Store up to 5 of the last accepted statements
+recent_statements_lock = threading.Lock()  # Shared by the build workers
+fallback_slots = set()  # Slots whose GPT request failed, see build_minute()
 
-def ask_gpt_for_encouraging_statement() -> str:
+def ask_gpt_for_encouraging_statement(cache_key) -> str:
     """
     Calls GPT (gpt-4o-mini or similar) for a short, uplifting Christian statement.
     We embed the last 5 accepted statements in the system prompt, telling GPT to
     avoid reusing them or sounding too similar. We also remind GPT to:
       - remain consistent with biblical truth,
       - employ synonyms, figurative speech, etc.
+    cache_key identifies the slot, see build_minute().
     """
 
     # Build a short "recent statements" string to show GPT
     # If we have fewer than 5, we'll show them all. If we have more, we slice the last 5.
-    last_5 = recent_statements[-5:]
+    with recent_statements_lock:
+        last_5 = recent_statements[-5:]
     joined_recent = "\n".join(f"- {st}" for st in last_5)
 
     # Construct the system prompt
@@ -107,7 +229,8 @@ def ask_gpt_for_encouraging_statement() -> str:
     user_prompt = "Write a short, encouraging Christian statement or verse that doesn't repeat the recent statements."
 
     try:
-        response = client.chat.completions.create(
+        candidate_text = chat_completion(
+            ["statement"] + list(cache_key),
             model="gpt-4o",   # or "gpt-3.5-turbo", "gpt-4", etc.
             messages=[
                 {"role": "system", "content": system_prompt},
@@ -116,26 +239,29 @@ def ask_gpt_for_encouraging_statement() -> str:
             temperature=0.9,       # Encourage more variety
             top_p=1.0
         )
-        candidate_text = response.choices[0].message.content.strip()
 
     except Exception as e:
         print(f"[ERROR] GPT request failed: {e}")
-        # fallback if API call fails
+        # fallback if API call fails, the slot is retried on the next run
         candidate_text = "Trust in the Lord with all your heart, and let His love guide your steps."
+        with recent_statements_lock:
+            fallback_slots.add(tuple(cache_key))
 
     # Update the recent statements buffer
-    recent_statements.append(candidate_text)
-    if len(recent_statements) > 5:
-        recent_statements.pop(0)
+    with recent_statements_lock:
+        recent_statements.append(candidate_text)
+        if len(recent_statements) > 5:
+            recent_statements.pop(0)
 
     return candidate_text
 
-def pick_best_verse(candidate_verses):
+def pick_best_verse(candidate_verses, rng, cache_key):
     """
     If we have 1..N candidate verses, ask GPT to pick the best.
       - If GPT says 'none':
          * If exactly 1 verse => generate a GPT statement
-         * If multiple verses => pick a random verse
+         * If multiple verses => pick a random verse (from rng)
+    cache_key identifies the slot, the candidate texts are added to it.
     """
     if not candidate_verses:
         return None
@@ -163,15 +289,15 @@ def pick_best_verse(candidate_verses):
     user_content += "\nWhich one is the best? Return only the number or 'none'."
 
     try:
-        response = client.chat.completions.create(
+        raw_reply = chat_completion(
+            ["pick"] + list(cache_key) + [v["text"] for v in candidate_verses],
             model="gpt-4o",
             messages=[
                 {"role": "system", "content": system_prompt},
                 {"role": "user", "content": user_content},
             ],
             temperature=0.0
-        )
-        raw_reply = response.choices[0].message.content.strip().lower()
+        ).lower()
 
         if raw_reply.startswith("none"):
             # If exactly 1 verse => generate GPT statement
@@ -179,7 +305,7 @@ def pick_best_verse(candidate_verses):
                 return None  # means we'll do GPT statement
             else:
                 # If multiple verses => pick random among them
-                return random.choice(candidate_verses)
+                return rng.choice(candidate_verses)
 
         # parse an integer index
         try:
@@ -189,14 +315,16 @@ def pick_best_verse(candidate_verses):
 
         if chosen_index < 0 or chosen_index >= len(candidate_verses):
             # If out of range => pick random
-            return random.choice(candidate_verses)
+            return rng.choice(candidate_verses)
 
         return candidate_verses[chosen_index]
 
     except Exception as e:
         print(f"[ERROR] GPT picking verse failed: {e}")
-        # fallback => pick random
-        return random.choice(candidate_verses)
+        # fallback => pick random, the slot is retried on the next run
+        with recent_statements_lock:
+            fallback_slots.add(tuple(cache_key))
+        return rng.choice(candidate_verses)
 
 # -----------------------------------------------------------------------------
 # 3) Sanitization + Format Fix
@@ -236,126 +364,313 @@ def fix_verse_format(text: str) -> str:
     return t
 
 # -----------------------------------------------------------------------------
-# 4) Main
+# 4) Binary verse index for the firmware
+# -----------------------------------------------------------------------------
+#
+# Little-endian layout, one slot per minute of the day (slot = hour*60 + minute,
+# hour 0..23; the "hour24" JSON file holds hour 0):
+#
+#   header  16 bytes   magic "BVRS", u16 version, u16 slot count (1440),
+#                      u32 offset of the string blob, u32 total file size
+#   table   1440 * 8   u32 absolute offset, u16 reference length, u16 text length
+#   blob               per slot: reference, NUL, text, NUL
+#
+# The firmware reads one hour's 60 table entries at a time and then each
+# verse with a single seek + read.
+
+VERSE_INDEX_MAGIC = b"BVRS"
+VERSE_INDEX_VERSION = 1
+VERSE_INDEX_SLOTS = 24 * 60
+VERSE_INDEX_HEADER = struct.Struct("<4sHHII")
+VERSE_INDEX_ENTRY = struct.Struct("<IHH")
+
+def write_verse_index(hour_results, filename):
+    """
+    hour_results: { hour (1..24): { "00".."59": {"reference": ..., "text": ...} } }
+    """
+    table_size = VERSE_INDEX_SLOTS * VERSE_INDEX_ENTRY.size
+    blob_offset = VERSE_INDEX_HEADER.size + table_size
+    table = bytearray()
+    blob = bytearray()
+
+    for slot in range(VERSE_INDEX_SLOTS):
+        hour, minute = divmod(slot, 60)
+        entry = hour_results.get(hour if hour else 24, {}).get(f"{minute:02d}", {})
+        ref = entry.get("reference", "").encode("utf-8")
+        text = entry.get("text", "").encode("utf-8")
+        table += VERSE_INDEX_ENTRY.pack(blob_offset + len(blob), len(ref), len(text))
+        blob += ref + b"\0" + text + b"\0"
+
+    header = VERSE_INDEX_HEADER.pack(VERSE_INDEX_MAGIC, VERSE_INDEX_VERSION, VERSE_INDEX_SLOTS,
+                                     blob_offset, blob_offset + len(blob))
+    with open(filename, "wb") as out_f:
+        out_f.write(header + table + blob)
+
+# Verse pack: several translations in one image for the "verses" partition,
+# every hour deflated on its own so the firmware only inflates the hour it
+# shows, streaming through a 4 KB ring buffer (hence the 4 KB window):
+#
+#   header  16 bytes   magic "BVPK", u16 version, u16 pack count,
+#                      u32 offset of the pack table, u32 total file size
+#   packs   count * 208
+#                      name (16 bytes, NUL padded), then per hour (0..23)
+#                      u32 absolute offset, u32 length of its deflate block
+#   blocks             raw deflate of: 60 * (u16 reference length,
+#                      u16 text length), then per minute reference, NUL,
+#                      text, NUL
+
+VERSE_PACK_MAGIC = b"BVPK"
+VERSE_PACK_VERSION = 1
+VERSE_PACK_HEADER = struct.Struct("<4sHHII")
+VERSE_PACK_NAME_LEN = 16
+VERSE_PACK_HOUR = struct.Struct("<II")
+VERSE_PACK_WINDOW_BITS = 12
+
+def pack_hour_block(hour_result):
+    lengths = bytearray()
+    strings = bytearray()
+    for minute in range(60):
+        entry = hour_result.get(f"{minute:02d}", {})
+        ref = entry.get("reference", "").encode("utf-8")
+        text = entry.get("text", "").encode("utf-8")
+        lengths += struct.pack("<HH", len(ref), len(text))
+        strings += ref + b"\0" + text + b"\0"
+    deflater = zlib.compressobj(9, zlib.DEFLATED, -VERSE_PACK_WINDOW_BITS)
+    return deflater.compress(bytes(lengths + strings)) + deflater.flush()
+
+def write_verse_pack(packs, filename):
+    """
+    packs: [(name, hour_results)], hour_results as for write_verse_index()
+    """
+    record_size = VERSE_PACK_NAME_LEN + 24 * VERSE_PACK_HOUR.size
+    table_offset = VERSE_PACK_HEADER.size
+    blocks_offset = table_offset + len(packs) * record_size
+    table = bytearray()
+    blocks = bytearray()
+
+    for name, hour_results in packs:
+        encoded = name.encode("utf-8")
+        if len(encoded) >= VERSE_PACK_NAME_LEN:
+            raise ValueError(f"pack name '{name}' is longer than {VERSE_PACK_NAME_LEN - 1} bytes")
+        table += encoded.ljust(VERSE_PACK_NAME_LEN, b"\0")
+        for hour in range(24):
+            block = pack_hour_block(hour_results.get(hour if hour else 24, {}))
+            table += VERSE_PACK_HOUR.pack(blocks_offset + len(blocks), len(block))
+            blocks += block
+
+    header = VERSE_PACK_HEADER.pack(VERSE_PACK_MAGIC, VERSE_PACK_VERSION, len(packs),
+                                    table_offset, blocks_offset + len(blocks))
+    with open(filename, "wb") as out_f:
+        out_f.write(header + table + blocks)
+    return blocks_offset + len(blocks)
+
+def hour_filename(out_dir, hour):
+    return os.path.join(out_dir, f"bible_verses_hour{hour:02d}.json")
+
+def load_hour_results(out_dir):
+    """Read back the bible_verses_hourNN.json files of a data folder."""
+    hour_results = {}
+    for hour in range(1, 25):
+        filename = hour_filename(out_dir, hour)
+        if os.path.exists(filename):
+            with open(filename, "r", encoding="utf-8") as f:
+                hour_results[hour] = json.load(f)
+    return hour_results
+
+def write_hour_file(out_dir, hour, hour_result):
+    """Replace an hour file in one step, a crash never leaves half of one."""
+    filename = hour_filename(out_dir, hour)
+    with open(filename + ".tmp", "w", encoding="utf-8") as out_f:
+        json.dump(hour_result, out_f, ensure_ascii=False, indent=2)
+    os.replace(filename + ".tmp", filename)
+
+# -----------------------------------------------------------------------------
+# 5) Database build
+# -----------------------------------------------------------------------------
+
+def build_minute(slot, chap_verse_map):
+    """
+    slot: (translation, hour 1..24, minute) => {"reference": ..., "text": ...}
+    plus "fallback": True when a GPT request failed and a stand-in was used.
+    Runs on the worker threads; the only shared state is the recent
+    statements buffer, the fallback slots and the response cache.
+    """
+    translation, hour, minute = slot
+    # Same candidates on every run, so the cached pick is found again
+    rng = random.Random(f"{translation}/{hour:02d}:{minute:02d}")
+
+    chosen = None
+    # Full hour => always GPT statement
+    if minute != 0 and (hour, minute) in chap_verse_map:
+        # We do have verses => ask GPT to pick best
+        possible_verses = chap_verse_map[(hour, minute)]
+        if len(possible_verses) > 20:
+            candidate_verses = rng.sample(possible_verses, 20)
+        else:
+            candidate_verses = possible_verses
+        # None means GPT said "none" but there's exactly 1 verse
+        chosen = pick_best_verse(candidate_verses, rng, slot)
+
+    if chosen is None:
+        # No verses, full hour or none acceptable => GPT statement
+        raw_ref = f"{hour:02d}:{minute:02d}"
+        from_gpt = ask_gpt_for_encouraging_statement(slot)
+        result = {
+            "reference": sanitize_string(raw_ref),
+            "text": fix_verse_format(sanitize_string(from_gpt))
+        }
+    else:
+        # GPT picked or we fallback to random among multiples
+        raw_ref = f"{hour:02d}:{minute:02d} ({chosen['book_name']})"
+        result = {
+            "reference": sanitize_string(raw_ref),
+            "text": fix_verse_format(sanitize_string(chosen["text"]))
+        }
+
+    with recent_statements_lock:
+        if slot in fallback_slots:
+            result["fallback"] = True
+    return result
+
+def has_fallback(hour_result):
+    return any(entry.get("fallback") for entry in hour_result.values())
+
+def build_database(translation, chap_verse_map, out_dir, workers, rebuild=False):
+    """
+    All 24 hour files of out_dir, returned as for write_verse_index().
+    Complete hour files already there are kept unless rebuild is set; the
+    others are written as soon as their last minute is done. An hour with a
+    fallback minute is written too, but not kept: the next run redoes it,
+    its other minutes then come from the response cache.
+    """
+    all_hours = {}
+    pending = {}
+    for hour in range(1, 25):
+        filename = hour_filename(out_dir, hour)
+        if not rebuild and os.path.exists(filename):
+            with open(filename, "r", encoding="utf-8") as f:
+                hour_result = json.load(f)
+            if len(hour_result) == 60 and not has_fallback(hour_result):
+                all_hours[hour] = hour_result
+                continue
+        pending[hour] = {}
+    if all_hours:
+        print(f"Keeping {len(all_hours)} finished hour files in '{out_dir}'")
+
+    from tqdm import tqdm  # pip install tqdm
+
+    slots = [(translation, hour, minute) for hour in pending for minute in range(60)]
+    pool = ThreadPoolExecutor(max_workers=workers)
+    try:
+        futures = {pool.submit(build_minute, slot, chap_verse_map): slot for slot in slots}
+        for future in tqdm(as_completed(futures), total=len(futures), desc="Processing minutes"):
+            _, hour, minute = futures[future]
+            hour_result = pending[hour]
+            hour_result[f"{minute:02d}"] = future.result()
+            if len(hour_result) == 60:
+                # Checkpoint: minutes in order, as the firmware streams them
+                all_hours[hour] = dict(sorted(hour_result.items()))
+                write_hour_file(out_dir, hour, all_hours[hour])
+    finally:
+        # On an error or Ctrl+C drop the queued minutes instead of running them
+        pool.shutdown(wait=True, cancel_futures=True)
+
+    retry = [hour for hour in sorted(all_hours) if has_fallback(all_hours[hour])]
+    if retry:
+        print(f"[WARNING] GPT failed in hours {', '.join(map(str, retry))}, "
+              "their fallback minutes are redone on the next run")
+    return all_hours
+
+# -----------------------------------------------------------------------------
+# 6) Main
 # -----------------------------------------------------------------------------
 def main():
     """
     Usage:
       python script.py biblesupersearch path/to/bible.json
-      python script.py jadenzaleski path/to/another_bible.json
+      python script.py jadenzaleski path/to/another_bible.json [--out data_luther] [--workers 8]
+      python script.py index data
+      python script.py pack verses.bin esv=data luther=data_luther
 
     Where:
       - 'biblesupersearch' expects { "metadata":{...}, "verses":[...]}
         from https://www.biblesupersearch.com/bible-downloads/
       - 'jadenzaleski' expects { "Genesis": {...}, "Exodus": {...}}
         from https://github.com/jadenzaleski/BibleTranslations
+      - --out, --name, --workers, --cache and --rebuild: see --help
+      - 'index' only rebuilds verses.bin from the JSON files in the given folder
+      - 'pack' combines the JSON files of several folders (one translation
+        each) into a verse pack image, the first pack is the default
     """
     import sys
 
     if len(sys.argv) < 3:
-        print("Usage: python script.py <format> <json_file>")
+        print("Usage: python script.py <format> <json_file> [options, see --help]")
         print("  format = 'biblesupersearch' or 'jadenzaleski'")
+        print("       or: python script.py index <data_folder>")
+        print("       or: python script.py pack <output> <name>=<data_folder> ...")
         sys.exit(1)
 
     bible_format = sys.argv[1]   # 'biblesupersearch' or 'jadenzaleski'
     bible_json_file = sys.argv[2]
 
-    # 1) Load JSON
-    with open(bible_json_file, "r", encoding="utf-8") as f:
-        data = json.load(f)
-
-    # 2) Parse according to chosen format
-    if bible_format == "biblesupersearch":
-        all_verses = data["verses"]  # e.g. {"metadata":{...}, "verses":[...]}
-    elif bible_format == "jadenzaleski":
-        all_verses = parse_jadenzaleski_bible(data)
-    else:
+    if bible_format == "pack":
+        packs = []
+        for arg in sys.argv[3:]:
+            name, sep, folder = arg.partition("=")
+            if not sep:
+                print(f"Expected <name>=<data_folder>, got '{arg}'")
+                sys.exit(1)
+            packs.append((name, load_hour_results(folder)))
+        if not packs:
+            print("No packs given")
+            sys.exit(1)
+        size = write_verse_pack(packs, bible_json_file)
+        print(f"Wrote {bible_json_file} ({len(packs)} packs, {size} bytes)")
+        return
+
+    if bible_format == "index":
+        index_file = os.path.join(bible_json_file, "verses.bin")
+        write_verse_index(load_hour_results(bible_json_file), index_file)
+        print(f"Wrote {index_file}")
+        return
+
+    ap = argparse.ArgumentParser(prog=f"{sys.argv[0]} {bible_format} {bible_json_file}")
+    ap.add_argument("--out", default="data", help="output folder (default: data)")
+    ap.add_argument("--name", help="translation name for the cache keys (default: JSON file name)")
+    ap.add_argument("--workers", type=int, default=8, help="concurrent GPT requests (default: 8)")
+    ap.add_argument("--cache", default=".gpt_cache",
+                    help="GPT response cache folder, '' to disable (default: .gpt_cache)")
+    ap.add_argument("--rebuild", action="store_true", help="also redo hour files that are complete")
+    options = ap.parse_args(sys.argv[3:])
+
+    # 1) (chapter, verse) -> list of verse dicts, built once per Bible JSON
+    if bible_format not in ("biblesupersearch", "jadenzaleski"):
         print(f"Unknown format: {bible_format}")
         sys.exit(1)
+    chap_verse_map = load_candidate_index(bible_format, bible_json_file)
 
-    # 3) Build (chapter, verse) -> list of verse dicts
-    chap_verse_map = {}
-    for v in all_verses:
-        c = v["chapter"]
-        r = v["verse"]
-        key = (c, r)
-        if key not in chap_verse_map:
-            chap_verse_map[key] = []
-        chap_verse_map[key].append(v)
-
-    # 4) Create output folder
-    out_dir = "data"
+    # 2) Create output folder, GPT client and response cache; 'index' and
+    #    'pack' run without the openai package or an API key
+    out_dir = options.out
     if not os.path.exists(out_dir):
         os.makedirs(out_dir)
-
-    # 5) Loop over 24 hours × 60 minutes with progress bars
-    for hour in tqdm(range(1, 25), desc="Processing Hours"):
-        hour_result = {}
-
-        for minute in tqdm(range(60), desc=f"Hour {hour}", leave=False):
-            minute_str = f"{minute:02d}"
-
-            # Full hour => always GPT statement
-            if minute == 0:
-                reference_str = f"{hour:02d}:{minute:02d}"
-                from_gpt = ask_gpt_for_encouraging_statement()
-                final_txt = fix_verse_format(sanitize_string(from_gpt))
-
-                hour_result[minute_str] = {
-                    "reference": sanitize_string(reference_str),
-                    "text": final_txt
-                }
-                continue
-
-            cv_key = (hour, minute)
-            # If no verses => GPT statement
-            if cv_key not in chap_verse_map:
-                raw_ref = f"{hour:02d}:{minute:02d}"
-                from_gpt = ask_gpt_for_encouraging_statement()
-                final_txt = fix_verse_format(sanitize_string(from_gpt))
-
-                hour_result[minute_str] = {
-                    "reference": sanitize_string(raw_ref),
-                    "text": final_txt
-                }
-            else:
-                # We do have verses => ask GPT to pick best
-                possible_verses = chap_verse_map[cv_key]
-                if len(possible_verses) > 20:
-                    candidate_verses = random.sample(possible_verses, 20)
-                else:
-                    candidate_verses = possible_verses
-
-                chosen = pick_best_verse(candidate_verses)
-                if chosen is None:
-                    # Means GPT said "none" but there's exactly 1 verse
-                    # => generate a GPT statement
-                    raw_ref = f"{hour:02d}:{minute:02d}"
-                    from_gpt = ask_gpt_for_encouraging_statement()
-                    final_txt = fix_verse_format(sanitize_string(from_gpt))
-
-                    hour_result[minute_str] = {
-                        "reference": sanitize_string(raw_ref),
-                        "text": final_txt
-                    }
-                else:
-                    # GPT picked or we fallback to random among multiples
-                    raw_ref = f"{hour:02d}:{minute:02d} ({chosen['book_name']})"
-                    ref_ok = sanitize_string(raw_ref)
-                    text_ok = sanitize_string(chosen["text"])
-                    text_ok = fix_verse_format(text_ok)
-
-                    hour_result[minute_str] = {
-                        "reference": ref_ok,
-                        "text": text_ok
-                    }
-
-        # Save JSON for this hour
-        filename = os.path.join(out_dir, f"bible_verses_hour{hour:02d}.json")
-        with open(filename, "w", encoding="utf-8") as out_f:
-            json.dump(hour_result, out_f, ensure_ascii=False, indent=2)
-
-    print("\nDone! Created 24 separate JSON files in 'data' folder.")
+    from openai import OpenAI
+    openai_api_key = os.getenv("OPENAI_API_KEY", "")
+    if not openai_api_key:
+        print("Warning: No OPENAI_API_KEY found. Please set env var or hardcode for testing.")
+    global client, response_cache
+    client = OpenAI(api_key=openai_api_key)
+    response_cache = ResponseCache(options.cache or None)
+
+    # 3) All 24 hours × 60 minutes on the worker pool, checkpointed per hour
+    translation = options.name or os.path.splitext(os.path.basename(bible_json_file))[0]
+    all_hours = build_database(translation, chap_verse_map, out_dir, options.workers, options.rebuild)
+
+    # 4) Binary index for the firmware
+    write_verse_index(all_hours, os.path.join(out_dir, "verses.bin"))
+
+    print(f"\nDone! Created 24 separate JSON files and verses.bin in '{out_dir}' folder.")
 
 if __name__ == "__main__":
     main()
@@ -28,6 +28,24 @@
 #
 ******************************************************************************/
 #include "DEV_Config.h"
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+
+#if USE_HW_SPI
+#include <driver/spi_master.h>
+#include <esp_heap_caps.h>
+#include <rom/gpio.h>
+#include <soc/gpio_sig_map.h>
+
+#define DEV_SPI_HOST HSPI_HOST
+
+static spi_device_handle_t spi_dev;
+static UBYTE *spi_dma_buf[2];
+static spi_transaction_t spi_trans[2];
+static UBYTE spi_buf_idx = 0;       // buffer currently being filled
+static UDOUBLE spi_buf_len = 0;     // bytes waiting in that buffer
+static UBYTE spi_in_flight = 0;     // queued transactions not yet collected
+#endif
 
 void GPIO_Config(void)
 {
@@ -40,12 +58,16 @@ void GPIO_Config(void)
     pinMode(EPD_RST_PIN , OUTPUT);
     pinMode(EPD_DC_PIN  , OUTPUT);
     
+#if !USE_HW_SPI
     pinMode(EPD_SCK_PIN, OUTPUT);
     pinMode(EPD_MOSI_PIN, OUTPUT);
+#endif
     pinMode(EPD_CS_PIN , OUTPUT);
 
     digitalWrite(EPD_CS_PIN , HIGH);
+#if !USE_HW_SPI
     digitalWrite(EPD_SCK_PIN, LOW);
+#endif
 }
 
 void GPIO_Mode(UWORD GPIO_Pin, UWORD Mode)
@@ -56,6 +78,189 @@ void GPIO_Mode(UWORD GPIO_Pin, UWORD Mode)
 		pinMode(GPIO_Pin , OUTPUT);
 	}
 }
+
+#if USE_BUSY_IRQ
+static SemaphoreHandle_t busy_sem = NULL;
+static void (*busy_callback)(void) = NULL;  // one-shot, see DEV_Busy_Notify()
+static portMUX_TYPE busy_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static void IRAM_ATTR DEV_Busy_ISR(void)
+{
+	BaseType_t woken = pdFALSE;
+	xSemaphoreGiveFromISR(busy_sem, &woken);
+
+	portENTER_CRITICAL_ISR(&busy_mux);
+	void (*callback)(void) = busy_callback;
+	busy_callback = NULL;
+	portEXIT_CRITICAL_ISR(&busy_mux);
+	if (callback) {
+		callback();
+	}
+
+	if (woken) {
+		portYIELD_FROM_ISR();
+	}
+}
+
+// Run a pending callback from task context when the level was reached
+// without an edge being seen
+static void DEV_Busy_Fire(void)
+{
+	portENTER_CRITICAL(&busy_mux);
+	void (*callback)(void) = busy_callback;
+	busy_callback = NULL;
+	portEXIT_CRITICAL(&busy_mux);
+	if (callback) {
+		callback();
+	}
+}
+#endif
+
+/******************************************************************************
+function:	Block until the BUSY pin reads Level
+Info:
+	With USE_BUSY_IRQ the calling task sleeps on a semaphore given by the
+	pin's edge interrupt, so other tasks get the CPU during a refresh. The
+	level is re-checked every 100 ms in case an edge slipped past before the
+	interrupt was attached.
+******************************************************************************/
+void DEV_Busy_Wait(UBYTE Level)
+{
+#if USE_BUSY_IRQ
+	if (DEV_Digital_Read(EPD_BUSY_PIN) != Level) {
+		xSemaphoreTake(busy_sem, 0); // drop a stale edge
+		attachInterrupt(digitalPinToInterrupt(EPD_BUSY_PIN), DEV_Busy_ISR, Level ? RISING : FALLING);
+		while (DEV_Digital_Read(EPD_BUSY_PIN) != Level) {
+			xSemaphoreTake(busy_sem, pdMS_TO_TICKS(100));
+		}
+	}
+	detachInterrupt(digitalPinToInterrupt(EPD_BUSY_PIN));
+	DEV_Busy_Fire();
+#else
+	while (DEV_Digital_Read(EPD_BUSY_PIN) != Level) {
+		DEV_Delay_ms(20);
+	}
+#endif
+}
+
+/******************************************************************************
+function:	Call Callback once the BUSY pin reaches Level, without blocking
+Info:
+	The callback runs in interrupt context (IRAM, no blocking calls, give a
+	semaphore or set a flag). If the level is already there it runs right
+	away. Without USE_BUSY_IRQ this degrades to DEV_Busy_Wait() + Callback.
+******************************************************************************/
+void DEV_Busy_Notify(UBYTE Level, void (*Callback)(void))
+{
+#if USE_BUSY_IRQ
+	xSemaphoreTake(busy_sem, 0);
+	portENTER_CRITICAL(&busy_mux);
+	busy_callback = Callback;
+	portEXIT_CRITICAL(&busy_mux);
+	attachInterrupt(digitalPinToInterrupt(EPD_BUSY_PIN), DEV_Busy_ISR, Level ? RISING : FALLING);
+	if (DEV_Digital_Read(EPD_BUSY_PIN) == Level) {
+		detachInterrupt(digitalPinToInterrupt(EPD_BUSY_PIN));
+		DEV_Busy_Fire();
+	}
+#else
+	DEV_Busy_Wait(Level);
+	if (Callback) {
+		Callback();
+	}
+#endif
+}
+
+/******************************************************************************
+function:	Light-sleep the whole chip until the BUSY pin reads Level
+Info:
+	Both cores stop and WiFi is suspended, so only use it when nothing else
+	has to run during the refresh. The edge interrupt of DEV_Busy_Notify()
+	is detached first: the wakeup turns the same pin into a level interrupt,
+	which would keep firing after the wake. The next DEV_Busy_Wait() or
+	DEV_Busy_Notify() attaches it again.
+******************************************************************************/
+void DEV_Busy_LightSleep(UBYTE Level)
+{
+#if USE_BUSY_IRQ
+	detachInterrupt(digitalPinToInterrupt(EPD_BUSY_PIN));
+#endif
+	gpio_wakeup_enable((gpio_num_t)EPD_BUSY_PIN, Level ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+	esp_sleep_enable_gpio_wakeup();
+	while (DEV_Digital_Read(EPD_BUSY_PIN) != Level) {
+		esp_light_sleep_start();
+	}
+	esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+	gpio_wakeup_disable((gpio_num_t)EPD_BUSY_PIN);
+#if USE_BUSY_IRQ
+	DEV_Busy_Fire();
+#endif
+}
+
+#if USE_HW_SPI
+/******************************************************************************
+function:	Initialize the HSPI bus and the (CS-less) e-Paper device
+Info:
+    SCK/MOSI are routed to the peripheral through the GPIO matrix, the
+    EPD driver keeps toggling CS/DC by hand around each command/data phase.
+    Two DMA bounce buffers let the CPU fill one chunk while the other is
+    on the wire.
+******************************************************************************/
+static UBYTE DEV_SPI_Init(void)
+{
+    spi_bus_config_t buscfg = {};
+    buscfg.mosi_io_num = EPD_MOSI_PIN;
+    buscfg.miso_io_num = -1;
+    buscfg.sclk_io_num = EPD_SCK_PIN;
+    buscfg.quadwp_io_num = -1;
+    buscfg.quadhd_io_num = -1;
+    buscfg.max_transfer_sz = DEV_SPI_DMA_CHUNK;
+    if (spi_bus_initialize(DEV_SPI_HOST, &buscfg, SPI_DMA_CH_AUTO) != ESP_OK) {
+        return 1;
+    }
+
+    spi_device_interface_config_t devcfg = {};
+    devcfg.clock_speed_hz = DEV_SPI_CLOCK_HZ;
+    devcfg.mode = 0;
+    devcfg.spics_io_num = -1;
+    devcfg.queue_size = 2;
+    if (spi_bus_add_device(DEV_SPI_HOST, &devcfg, &spi_dev) != ESP_OK) {
+        return 1;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        spi_dma_buf[i] = (UBYTE *)heap_caps_malloc(DEV_SPI_DMA_CHUNK, MALLOC_CAP_DMA);
+        if (spi_dma_buf[i] == NULL) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void DEV_SPI_Collect(void)
+{
+    spi_transaction_t *done;
+    spi_device_get_trans_result(spi_dev, &done, portMAX_DELAY);
+    spi_in_flight--;
+}
+
+static void DEV_SPI_Submit(void)
+{
+    spi_transaction_t *t = &spi_trans[spi_buf_idx];
+    memset(t, 0, sizeof(*t));
+    t->length = spi_buf_len * 8;
+    t->tx_buffer = spi_dma_buf[spi_buf_idx];
+    spi_device_queue_trans(spi_dev, t, portMAX_DELAY);
+    spi_in_flight++;
+
+    spi_buf_idx ^= 1;
+    spi_buf_len = 0;
+    // The buffer we are about to refill belongs to the older transfer
+    if (spi_in_flight > 1) {
+        DEV_SPI_Collect();
+    }
+}
+#endif
+
 /******************************************************************************
 function:	Module Initialize, the BCM2835 library and initialize the pins, SPI protocol
 parameter:
@@ -65,15 +270,22 @@ UBYTE DEV_Module_Init(void)
 {
 	//gpio
 	GPIO_Config();
+#if USE_BUSY_IRQ
+	if (busy_sem == NULL) {
+		busy_sem = xSemaphoreCreateBinary();
+	}
+#endif
 
 	//serial printf
 	Serial.begin(115200);
 
 	// spi
-	// SPI.setDataMode(SPI_MODE0);
-	// SPI.setBitOrder(MSBFIRST);
-	// SPI.setClockDivider(SPI_CLOCK_DIV4);
-	// SPI.begin();
+#if USE_HW_SPI
+	if (DEV_SPI_Init() != 0) {
+		Serial.println("SPI init failed");
+		return 1;
+	}
+#endif
 
 	return 0;
 }
@@ -82,9 +294,97 @@ UBYTE DEV_Module_Init(void)
 function:
 			SPI read and write
 ******************************************************************************/
+#if USE_HW_SPI
+void DEV_SPI_WriteByte(UBYTE data)
+{
+    DEV_SPI_Stream_Flush();
+
+    spi_transaction_t t = {};
+    t.flags = SPI_TRANS_USE_TXDATA;
+    t.length = 8;
+    t.tx_data[0] = data;
+    spi_device_polling_transmit(spi_dev, &t);
+}
+
+UBYTE DEV_SPI_ReadByte()
+{
+    // 3-wire read on the DIN line: borrow the pins from the peripheral,
+    // bit-bang one byte and hand them back through the GPIO matrix
+    UBYTE j=0xff;
+    DEV_SPI_Stream_Flush();
+    pinMode(EPD_SCK_PIN, OUTPUT);
+    GPIO_Mode(EPD_MOSI_PIN, 0);
+    digitalWrite(EPD_CS_PIN, GPIO_PIN_RESET);
+    for (int i = 0; i < 8; i++)
+    {
+        j = j << 1;
+        if (digitalRead(EPD_MOSI_PIN))  j = j | 0x01;
+        else                            j = j & 0xfe;
+        
+        digitalWrite(EPD_SCK_PIN, GPIO_PIN_SET);     
+        digitalWrite(EPD_SCK_PIN, GPIO_PIN_RESET);
+    }
+    digitalWrite(EPD_CS_PIN, GPIO_PIN_SET);
+    GPIO_Mode(EPD_MOSI_PIN, 1);
+    gpio_matrix_out(EPD_MOSI_PIN, HSPID_OUT_IDX, false, false);
+    gpio_matrix_out(EPD_SCK_PIN, HSPICLK_OUT_IDX, false, false);
+    return j;
+}
+
+/******************************************************************************
+function:	Queue bytes for DMA (optionally XOR-ed on the way into the
+            bounce buffer, e.g. 0xFF to invert a plane)
+Info:
+    May return before the bytes are on the wire, callers must
+    DEV_SPI_Stream_Flush() before releasing CS or changing DC.
+******************************************************************************/
+void DEV_SPI_Stream_Write(const UBYTE *pData, UDOUBLE len, UBYTE Xor)
+{
+    while (len > 0) {
+        UDOUBLE n = DEV_SPI_DMA_CHUNK - spi_buf_len;
+        if (n > len) n = len;
+
+        UBYTE *dst = spi_dma_buf[spi_buf_idx] + spi_buf_len;
+        if (Xor == 0) {
+            memcpy(dst, pData, n);
+        } else {
+            for (UDOUBLE i = 0; i < n; i++)
+                dst[i] = pData[i] ^ Xor;
+        }
+        spi_buf_len += n;
+        pData += n;
+        len -= n;
+
+        if (spi_buf_len == DEV_SPI_DMA_CHUNK)
+            DEV_SPI_Submit();
+    }
+}
+
+void DEV_SPI_Stream_Fill(UBYTE Value, UDOUBLE len)
+{
+    while (len > 0) {
+        UDOUBLE n = DEV_SPI_DMA_CHUNK - spi_buf_len;
+        if (n > len) n = len;
+
+        memset(spi_dma_buf[spi_buf_idx] + spi_buf_len, Value, n);
+        spi_buf_len += n;
+        len -= n;
+
+        if (spi_buf_len == DEV_SPI_DMA_CHUNK)
+            DEV_SPI_Submit();
+    }
+}
+
+void DEV_SPI_Stream_Flush(void)
+{
+    if (spi_buf_len > 0)
+        DEV_SPI_Submit();
+    while (spi_in_flight > 0)
+        DEV_SPI_Collect();
+}
+#else
 void DEV_SPI_WriteByte(UBYTE data)
 {
-    //SPI.beginTransaction(spi_settings);
     digitalWrite(EPD_CS_PIN, GPIO_PIN_RESET);
 
     for (int i = 0; i < 8; i++)
@@ -97,9 +397,7 @@ void DEV_SPI_WriteByte(UBYTE data)
         digitalWrite(EPD_SCK_PIN, GPIO_PIN_RESET);
     }
 
-    //SPI.transfer(data);
     digitalWrite(EPD_CS_PIN, GPIO_PIN_SET);
-    //SPI.endTransaction();	
 }
 
 UBYTE DEV_SPI_ReadByte()
@@ -121,10 +419,27 @@ UBYTE DEV_SPI_ReadByte()
     return j;
 }
 
-void DEV_SPI_Write_nByte(UBYTE *pData, UDOUBLE len)
+void DEV_SPI_Stream_Write(const UBYTE *pData, UDOUBLE len, UBYTE Xor)
+{
+    for (UDOUBLE i = 0; i < len; i++)
+        DEV_SPI_WriteByte(pData[i] ^ Xor);
+}
+
+void DEV_SPI_Stream_Fill(UBYTE Value, UDOUBLE len)
+{
+    for (UDOUBLE i = 0; i < len; i++)
+        DEV_SPI_WriteByte(Value);
+}
+
+void DEV_SPI_Stream_Flush(void)
+{
+}
+#endif
+
+void DEV_SPI_Write_nByte(const UBYTE *pData, UDOUBLE len)
 {
-    for (int i = 0; i < len; i++)
-        DEV_SPI_WriteByte(pData[i]);
+    DEV_SPI_Stream_Write(pData, len, 0x00);
+    DEV_SPI_Stream_Flush();
 }
 
 
@@ -31,6 +31,67 @@
 #include "EPD_3in52b.h"
 #include "Debug.h"
 
+// A partial refresh is still running and PARTIAL_OUT has to follow it
+static UBYTE EPD_3IN52B_PartialPending = 0;
+// Planes whose controller RAM holds the image last sent for them (reset and
+// deep sleep lose it)
+static UBYTE EPD_3IN52B_PlanesValid = 0;
+// Plane bytes sent since EPD_3IN52B_TakeBytesSent()
+static UDOUBLE EPD_3IN52B_BytesSent = 0;
+// Waveform the controller is set up for
+static EPD_3IN52B_LUT EPD_3IN52B_Lut = EPD_3IN52B_LUT_OTP;
+// Swaps the KW/WK tables of every GC refresh to keep the drive DC balanced
+unsigned char EPD_3IN52B_Flag = 0;
+
+/******************************************************************************
+ * Black/white waveforms of the mono 3.52" panel on the same controller, one
+ * phase per 7 bytes, unused phases zero. 0x20 is VCOM, 0x21 white to white,
+ * 0x22 black to white, 0x23 white to black, 0x24 black to black.
+******************************************************************************/
+static const UBYTE EPD_3IN52B_lut_R20_GC[56] = {
+    0x01, 0x0F, 0x0F, 0x0F, 0x01, 0x01, 0x01,
+};
+static const UBYTE EPD_3IN52B_lut_R21_GC[42] = {
+    0x01, 0x4F, 0x8F, 0x0F, 0x01, 0x01, 0x01,
+};
+static const UBYTE EPD_3IN52B_lut_R22_GC[42] = {
+    0x01, 0x0F, 0x8F, 0x0F, 0x01, 0x01, 0x01,
+};
+static const UBYTE EPD_3IN52B_lut_R23_GC[42] = {
+    0x01, 0x4F, 0x8F, 0x4F, 0x01, 0x01, 0x01,
+};
+static const UBYTE EPD_3IN52B_lut_R24_GC[42] = {
+    0x01, 0x0F, 0x8F, 0x4F, 0x01, 0x01, 0x01,
+};
+
+static const UBYTE EPD_3IN52B_lut_R20_DU[56] = {
+    0x01, 0x0F, 0x01, 0x00, 0x00, 0x01, 0x01,
+};
+static const UBYTE EPD_3IN52B_lut_R21_DU[42] = {
+    0x01, 0x0F, 0x01, 0x00, 0x00, 0x01, 0x01,
+};
+static const UBYTE EPD_3IN52B_lut_R22_DU[42] = {
+    0x01, 0x8F, 0x01, 0x00, 0x00, 0x01, 0x01,
+};
+static const UBYTE EPD_3IN52B_lut_R23_DU[42] = {
+    0x01, 0x4F, 0x01, 0x00, 0x00, 0x01, 0x01,
+};
+static const UBYTE EPD_3IN52B_lut_R24_DU[42] = {
+    0x01, 0x0F, 0x01, 0x00, 0x00, 0x01, 0x01,
+};
+
+/******************************************************************************
+function :	Read Busy
+parameter:
+******************************************************************************/
+void EPD_3IN52B_ReadBusy(void)
+{
+    Debug("e-Paper busy\r\n");
+    DEV_Busy_Wait(1); // BUSY is low while the controller works
+    Debug("e-Paper busy release\r\n");
+}
+
+
 /******************************************************************************
 function :	Software reset
 parameter:
@@ -38,11 +99,15 @@ parameter:
 void EPD_3IN52B_Reset(void)
 {
     DEV_Digital_Write(EPD_RST_PIN, 1);
-    DEV_Delay_ms(200);
+    DEV_Delay_ms(10);
     DEV_Digital_Write(EPD_RST_PIN, 0);
     DEV_Delay_ms(2);
     DEV_Digital_Write(EPD_RST_PIN, 1);
-    DEV_Delay_ms(200);
+    DEV_Delay_ms(10);
+    EPD_3IN52B_PartialPending = 0;
+    EPD_3IN52B_PlanesValid = 0;
+    EPD_3IN52B_Lut = EPD_3IN52B_LUT_OTP;
+    EPD_3IN52B_ReadBusy(); // BUSY comes up once the controller left reset
 }
 
 /******************************************************************************
@@ -72,30 +137,197 @@ void EPD_3IN52B_SendData(UBYTE Data)
 }
 
 /******************************************************************************
-function :	Read Busy
+function :	send a block of data with a single DC/CS assertion
 parameter:
+    pData : Data to write
+    Len   : Number of bytes
 ******************************************************************************/
-void EPD_3IN52B_ReadBusy(void)
+void EPD_3IN52B_SendDataBuffer(const UBYTE *pData, size_t Len)
 {
-    Debug("e-Paper busy\r\n");
-    while(!DEV_Digital_Read(EPD_BUSY_PIN))
-    {
-        DEV_Delay_ms(20);
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    DEV_SPI_Write_nByte(pData, Len);
+    DEV_Digital_Write(EPD_CS_PIN, 1);
+}
+
+/******************************************************************************
+function :	send a rectangle of one plane (inverted, the controller expects 1 = ink)
+parameter:
+     Reg    : 0x10 black/white plane, 0x13 red/yellow plane
+     image  : Full-frame plane buffer, NULL sends an empty rectangle
+     Xbyte  : First byte column
+     Wbyte  : Number of byte columns
+     Ystart : First row
+     Yend   : Last row (inclusive)
+******************************************************************************/
+static void EPD_3IN52B_SendWindowPlane(UBYTE Reg, const UBYTE *image,
+                                       UWORD Xbyte, UWORD Wbyte, UWORD Ystart, UWORD Yend)
+{
+    UWORD Width;
+    Width = (EPD_3IN52B_WIDTH % 8 == 0)? (EPD_3IN52B_WIDTH / 8 ): (EPD_3IN52B_WIDTH / 8 + 1);
+
+    EPD_3IN52B_SendCommand(Reg);
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    if (image != NULL && Wbyte == Width) {
+        DEV_SPI_Stream_Write(image + (UDOUBLE)Ystart * Width, (UDOUBLE)Width * (Yend - Ystart + 1), 0xFF);
+    } else {
+        for (UWORD j = Ystart; j <= Yend; j++) {
+            if (image != NULL)
+                DEV_SPI_Stream_Write(image + Xbyte + (UDOUBLE)j * Width, Wbyte, 0xFF);
+            else
+                DEV_SPI_Stream_Fill(0x00, Wbyte);
+        }
     }
-    DEV_Delay_ms(200);
-    Debug("e-Paper busy release\r\n");
+    DEV_SPI_Stream_Flush();
+    DEV_Digital_Write(EPD_CS_PIN, 1);
+    EPD_3IN52B_BytesSent += (UDOUBLE)Wbyte * (Yend - Ystart + 1);
 }
 
+static void EPD_3IN52B_SendPlane(UBYTE Reg, const UBYTE *image)
+{
+    UWORD Width;
+    Width = (EPD_3IN52B_WIDTH % 8 == 0)? (EPD_3IN52B_WIDTH / 8 ): (EPD_3IN52B_WIDTH / 8 + 1);
+
+    EPD_3IN52B_SendWindowPlane(Reg, image, 0, Width, 0, EPD_3IN52B_HEIGHT - 1);
+    UBYTE Plane = (Reg == 0x10) ? EPD_3IN52B_PLANE_BLACK : EPD_3IN52B_PLANE_RED;
+    if (image != NULL)
+        EPD_3IN52B_PlanesValid |= Plane;
+    else
+        EPD_3IN52B_PlanesValid &= ~Plane;
+}
+
+/******************************************************************************
+function :	send both planes merged into one black/white plane (ink where
+            either has ink)
+parameter:
+     Reg        : 0x10 old data, 0x13 new data (KW mode)
+     blackimage : Full-frame black/white plane
+     ryimage    : Full-frame red/yellow plane
+******************************************************************************/
+static void EPD_3IN52B_SendMergedPlane(UBYTE Reg, const UBYTE *blackimage, const UBYTE *ryimage)
+{
+    UWORD Width;
+    Width = (EPD_3IN52B_WIDTH % 8 == 0)? (EPD_3IN52B_WIDTH / 8 ): (EPD_3IN52B_WIDTH / 8 + 1);
+    UBYTE Row[EPD_3IN52B_WIDTH / 8 + 1];
+
+    EPD_3IN52B_SendCommand(Reg);
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    for (UWORD j = 0; j < EPD_3IN52B_HEIGHT; j++) {
+        UDOUBLE Offset = (UDOUBLE)j * Width;
+        for (UWORD i = 0; i < Width; i++)
+            Row[i] = blackimage[Offset + i] & ryimage[Offset + i];
+        DEV_SPI_Stream_Write(Row, Width, 0xFF);
+    }
+    DEV_SPI_Stream_Flush();
+    DEV_Digital_Write(EPD_CS_PIN, 1);
+    EPD_3IN52B_BytesSent += (UDOUBLE)Width * EPD_3IN52B_HEIGHT;
+}
+
+static void EPD_3IN52B_SendLut(UBYTE Reg, const UBYTE *Lut, size_t Len)
+{
+    EPD_3IN52B_SendCommand(Reg);
+    EPD_3IN52B_SendDataBuffer(Lut, Len);
+}
+
+/******************************************************************************
+function :	Switch the panel setting and LUT registers to a waveform
+parameter:
+     Lut : Waveform of the next refresh
+Info:
+    OTP is the tri-color (KWR) mode EPD_3IN52B_Init() sets up. GC and DU
+    switch to black/white (KW) mode with the LUTs from registers; GC is
+    reloaded every time to alternate its KW/WK tables.
+******************************************************************************/
+static void EPD_3IN52B_SetLut(EPD_3IN52B_LUT Lut)
+{
+    if (Lut == EPD_3IN52B_Lut && Lut != EPD_3IN52B_LUT_GC)
+        return;
+
+    EPD_3IN52B_SendCommand(0x00); // PANEL_SETTING
+    EPD_3IN52B_SendData(Lut == EPD_3IN52B_LUT_OTP ? 0x03 : 0x33); // + REG (LUT from registers), KW mode
+    EPD_3IN52B_SendData(0x0D);
+
+    if (Lut == EPD_3IN52B_LUT_GC) {
+        EPD_3IN52B_SendLut(0x20, EPD_3IN52B_lut_R20_GC, sizeof(EPD_3IN52B_lut_R20_GC));
+        EPD_3IN52B_SendLut(0x21, EPD_3IN52B_lut_R21_GC, sizeof(EPD_3IN52B_lut_R21_GC));
+        EPD_3IN52B_SendLut(0x24, EPD_3IN52B_lut_R24_GC, sizeof(EPD_3IN52B_lut_R24_GC));
+        EPD_3IN52B_SendLut(0x22, EPD_3IN52B_Flag ? EPD_3IN52B_lut_R23_GC : EPD_3IN52B_lut_R22_GC, 42);
+        EPD_3IN52B_SendLut(0x23, EPD_3IN52B_Flag ? EPD_3IN52B_lut_R22_GC : EPD_3IN52B_lut_R23_GC, 42);
+        EPD_3IN52B_Flag = !EPD_3IN52B_Flag;
+    } else if (Lut == EPD_3IN52B_LUT_DU) {
+        EPD_3IN52B_SendLut(0x20, EPD_3IN52B_lut_R20_DU, sizeof(EPD_3IN52B_lut_R20_DU));
+        EPD_3IN52B_SendLut(0x21, EPD_3IN52B_lut_R21_DU, sizeof(EPD_3IN52B_lut_R21_DU));
+        EPD_3IN52B_SendLut(0x22, EPD_3IN52B_lut_R22_DU, sizeof(EPD_3IN52B_lut_R22_DU));
+        EPD_3IN52B_SendLut(0x23, EPD_3IN52B_lut_R23_DU, sizeof(EPD_3IN52B_lut_R23_DU));
+        EPD_3IN52B_SendLut(0x24, EPD_3IN52B_lut_R24_DU, sizeof(EPD_3IN52B_lut_R24_DU));
+    }
+    EPD_3IN52B_Lut = Lut;
+}
+
+/******************************************************************************
+function :	Finish the running operation once BUSY has been released
+parameter:
+******************************************************************************/
+static void EPD_3IN52B_Complete(void)
+{
+    if (EPD_3IN52B_PartialPending) {
+        EPD_3IN52B_SendCommand(0x92); // PARTIAL_OUT
+        EPD_3IN52B_PartialPending = 0;
+    }
+}
+
+/******************************************************************************
+function :	Whether the controller is still refreshing
+parameter:
+******************************************************************************/
+UBYTE EPD_3IN52B_IsBusy(void)
+{
+    return DEV_Digital_Read(EPD_BUSY_PIN) == 0;
+}
+
+/******************************************************************************
+function :	Block until the last refresh has finished
+parameter:
+Info:
+    Every entry point that talks to the controller calls this first, so an
+    async refresh only has to be waited for explicitly when the caller needs
+    to know it is done.
+******************************************************************************/
+void EPD_3IN52B_WaitIdle(void)
+{
+    EPD_3IN52B_ReadBusy();
+    EPD_3IN52B_Complete();
+}
+
+/******************************************************************************
+function :	Like EPD_3IN52B_WaitIdle(), but light-sleep the chip meanwhile
+parameter:
+******************************************************************************/
+void EPD_3IN52B_SleepUntilIdle(void)
+{
+    DEV_Busy_LightSleep(1);
+    EPD_3IN52B_Complete();
+}
 
 /******************************************************************************
 function :	Turn On Display
 parameter:
+    Done : Called from the BUSY interrupt when the refresh has finished,
+           may be NULL
 ******************************************************************************/
-static void EPD_3IN52B_TurnOnDisplay(void)
+static void EPD_3IN52B_TurnOnDisplayAsync(EPD_3IN52B_Callback Done)
 {
     EPD_3IN52B_SendCommand(0x12); // DISPLAY_REFRESH
     // EPD_3IN52B_SendData(0xA5);	
-    EPD_3IN52B_ReadBusy();
+    DEV_Busy_Notify(1, Done);
+}
+
+static void EPD_3IN52B_TurnOnDisplay(void)
+{
+    EPD_3IN52B_TurnOnDisplayAsync(NULL);
+    EPD_3IN52B_WaitIdle();
 }
 
 /******************************************************************************
@@ -107,7 +339,6 @@ void EPD_3IN52B_Init(void)
     EPD_3IN52B_Reset();
 
     EPD_3IN52B_SendCommand(0x04); //POWER ON
-	DEV_Delay_ms(100);
     EPD_3IN52B_ReadBusy();
 
     EPD_3IN52B_SendCommand(0x00);	 
@@ -128,83 +359,195 @@ void EPD_3IN52B_Init(void)
 
 }
 
-void EPD_3IN52B_Display(const UBYTE *blackimage, const UBYTE *ryimage)
+/******************************************************************************
+function :	Upload both planes and start a full refresh without waiting for it
+parameter:
+    blackimage : Full-frame black/white plane
+    ryimage    : Full-frame red/yellow plane
+    Done       : Called from the BUSY interrupt when the refresh has finished,
+                 may be NULL
+******************************************************************************/
+void EPD_3IN52B_DisplayAsync(const UBYTE *blackimage, const UBYTE *ryimage,
+                             EPD_3IN52B_Callback Done)
 {
-    UWORD Width, Height;
-    Width = (EPD_3IN52B_WIDTH % 8 == 0)? (EPD_3IN52B_WIDTH / 8 ): (EPD_3IN52B_WIDTH / 8 + 1);
-    Height = EPD_3IN52B_HEIGHT;
+    EPD_3IN52B_DisplayPlanesAsync(blackimage, ryimage, EPD_3IN52B_PLANE_ALL, Done);
+}
 
-    EPD_3IN52B_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_3IN52B_SendData(~blackimage[i + j * Width]);
-        }
-    }
+/******************************************************************************
+function :	Full refresh that uploads only the planes that changed
+parameter:
+    blackimage : Full-frame black/white plane
+    ryimage    : Full-frame red/yellow plane
+    Changed    : EPD_3IN52B_PLANE_* that differ from the last frame sent
+    Done       : Called from the BUSY interrupt when the refresh has finished,
+                 may be NULL
+Info:
+    A plane is sent anyway when the controller RAM no longer holds it (after
+    reset or deep sleep), so Changed only has to be right about the images.
+******************************************************************************/
+void EPD_3IN52B_DisplayPlanesAsync(const UBYTE *blackimage, const UBYTE *ryimage, UBYTE Changed,
+                                   EPD_3IN52B_Callback Done)
+{
+    EPD_3IN52B_WaitIdle();
+    EPD_3IN52B_SetLut(EPD_3IN52B_LUT_OTP);
+    Changed |= EPD_3IN52B_PLANE_ALL & ~EPD_3IN52B_PlanesValid;
+    if (Changed & EPD_3IN52B_PLANE_BLACK)
+        EPD_3IN52B_SendPlane(0x10, blackimage);
+    if (Changed & EPD_3IN52B_PLANE_RED)
+        EPD_3IN52B_SendPlane(0x13, ryimage);
 
-    EPD_3IN52B_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_3IN52B_SendData(~ryimage[i + j * Width]);
-        }
-    }
+    EPD_3IN52B_TurnOnDisplayAsync(Done);
+}
 
-    EPD_3IN52B_TurnOnDisplay();
+void EPD_3IN52B_Display(const UBYTE *blackimage, const UBYTE *ryimage)
+{
+    EPD_3IN52B_DisplayAsync(blackimage, ryimage, NULL);
+    EPD_3IN52B_WaitIdle();
 }
 
 
 void EPD_3IN52B_Display_NUM(const UBYTE *image,UBYTE NUM)
 {
-    UWORD Width, Height;
-    Width = (EPD_3IN52B_WIDTH % 8 == 0)? (EPD_3IN52B_WIDTH / 8 ): (EPD_3IN52B_WIDTH / 8 + 1);
-    Height = EPD_3IN52B_HEIGHT;
-
+    EPD_3IN52B_WaitIdle();
+    EPD_3IN52B_SetLut(EPD_3IN52B_LUT_OTP);
     if (NUM == 0)
     {
-        EPD_3IN52B_SendCommand(0x10);
-        for (UWORD j = 0; j < Height; j++) {
-            for (UWORD i = 0; i < Width; i++) {
-                EPD_3IN52B_SendData(~image[i + j * Width]);
-            }
-        }
+        EPD_3IN52B_SendPlane(0x10, image);
     }
 
     
 
     if (NUM != 0)
     {
-        EPD_3IN52B_SendCommand(0x13);
-        for (UWORD j = 0; j < Height; j++) {
-            for (UWORD i = 0; i < Width; i++) {
-                EPD_3IN52B_SendData(~image[i + j * Width]);
-            }
-        }
+        EPD_3IN52B_SendPlane(0x13, image);
         EPD_3IN52B_TurnOnDisplay();
     }
 }
 
 /******************************************************************************
-function :	Clear screen
+function :	Black/white refresh with a waveform from registers
 parameter:
+    oldblack, oldry     : The frame on the panel now
+    blackimage, ryimage : The frame to show
+    Lut                 : EPD_3IN52B_LUT_GC or EPD_3IN52B_LUT_DU
+    Done                : Called from the BUSY interrupt when the refresh has
+                          finished, may be NULL
+Info:
+    Both frames are sent as one black/white plane each (red ink counts as
+    black), old data to 0x10 and new data to 0x13, which in KW mode pick the
+    waveform of every pixel. Red pixels that stay inked get the black to
+    black waveform and mostly keep their color, new ink is black. Run a
+    tri-color refresh now and then to bring the red back and clear the
+    ghosting.
 ******************************************************************************/
-void EPD_3IN52B_Clear(void)
+void EPD_3IN52B_DisplayFastAsync(const UBYTE *oldblack, const UBYTE *oldry,
+                                 const UBYTE *blackimage, const UBYTE *ryimage,
+                                 EPD_3IN52B_LUT Lut, EPD_3IN52B_Callback Done)
 {
-    UWORD Width, Height;
-    Width = (EPD_3IN52B_WIDTH % 8 == 0)? (EPD_3IN52B_WIDTH / 8 ): (EPD_3IN52B_WIDTH / 8 + 1);
-    Height = EPD_3IN52B_HEIGHT;
+    EPD_3IN52B_WaitIdle();
+    EPD_3IN52B_SetLut(Lut == EPD_3IN52B_LUT_GC ? EPD_3IN52B_LUT_GC : EPD_3IN52B_LUT_DU);
+    EPD_3IN52B_SendMergedPlane(0x10, oldblack, oldry);
+    EPD_3IN52B_SendMergedPlane(0x13, blackimage, ryimage);
+    EPD_3IN52B_PlanesValid = 0; // The RAM holds black/white data now
 
-    EPD_3IN52B_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_3IN52B_SendData(0x00);
-        }
-    }
+    EPD_3IN52B_TurnOnDisplayAsync(Done);
+}
 
-    EPD_3IN52B_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_3IN52B_SendData(0x00);
-        }
-    }
+/******************************************************************************
+function :	Upload and refresh only a window of the panel
+parameter:
+    x, y, w, h : Window in panel memory coordinates (EPD_3IN52B_WIDTH across,
+                 EPD_3IN52B_HEIGHT down), x/w are widened to whole bytes
+    blackimage : Full-frame black/white plane
+    ryimage    : Full-frame red/yellow plane
+    Done       : Called from the BUSY interrupt when the refresh has finished,
+                 may be NULL (PARTIAL_OUT is sent by the next call into the
+                 driver, or by EPD_3IN52B_WaitIdle())
+******************************************************************************/
+void EPD_3IN52B_DisplayWindowAsync(UWORD x, UWORD y, UWORD w, UWORD h,
+                                   const UBYTE *blackimage, const UBYTE *ryimage,
+                                   EPD_3IN52B_Callback Done)
+{
+    EPD_3IN52B_DisplayWindowPlanesAsync(x, y, w, h, blackimage, ryimage, EPD_3IN52B_PLANE_ALL, Done);
+}
+
+/******************************************************************************
+function :	Window refresh that uploads only the planes that changed
+parameter:
+    x, y, w, h : As for EPD_3IN52B_DisplayWindowAsync()
+    Changed    : EPD_3IN52B_PLANE_* that differ inside the window
+Info:
+    An unchanged plane is skipped only while the controller RAM holds it,
+    the window of the other plane is left as it was.
+******************************************************************************/
+void EPD_3IN52B_DisplayWindowPlanesAsync(UWORD x, UWORD y, UWORD w, UWORD h,
+                                         const UBYTE *blackimage, const UBYTE *ryimage, UBYTE Changed,
+                                         EPD_3IN52B_Callback Done)
+{
+    EPD_3IN52B_WaitIdle();
+    if (w == 0 || h == 0 || x >= EPD_3IN52B_WIDTH || y >= EPD_3IN52B_HEIGHT)
+        return;
+    EPD_3IN52B_SetLut(EPD_3IN52B_LUT_OTP);
+
+    UWORD Xstart = x & 0xF8;
+    UWORD Xend = x + w - 1;
+    UWORD Yend = y + h - 1;
+    if (Xend > EPD_3IN52B_WIDTH - 1)
+        Xend = EPD_3IN52B_WIDTH - 1;
+    if (Yend > EPD_3IN52B_HEIGHT - 1)
+        Yend = EPD_3IN52B_HEIGHT - 1;
+    Xend |= 0x07;
+
+    EPD_3IN52B_SendCommand(0x91); // PARTIAL_IN
+    EPD_3IN52B_SendCommand(0x90); // PARTIAL_WINDOW
+    EPD_3IN52B_SendData(Xstart);
+    EPD_3IN52B_SendData(Xend);
+    EPD_3IN52B_SendData(y >> 8);
+    EPD_3IN52B_SendData(y & 0xFF);
+    EPD_3IN52B_SendData(Yend >> 8);
+    EPD_3IN52B_SendData(Yend & 0xFF);
+    EPD_3IN52B_SendData(0x01);    // PT_SCAN: gates scan inside and outside the window
+
+    UWORD Xbyte = Xstart / 8;
+    UWORD Wbyte = (Xend + 1) / 8 - Xbyte;
+    Changed |= EPD_3IN52B_PLANE_ALL & ~EPD_3IN52B_PlanesValid;
+    if (Changed & EPD_3IN52B_PLANE_BLACK)
+        EPD_3IN52B_SendWindowPlane(0x10, blackimage, Xbyte, Wbyte, y, Yend);
+    if (Changed & EPD_3IN52B_PLANE_RED)
+        EPD_3IN52B_SendWindowPlane(0x13, ryimage, Xbyte, Wbyte, y, Yend);
+
+    EPD_3IN52B_PartialPending = 1;
+    EPD_3IN52B_TurnOnDisplayAsync(Done);
+}
+
+void EPD_3IN52B_DisplayWindow(UWORD x, UWORD y, UWORD w, UWORD h,
+                              const UBYTE *blackimage, const UBYTE *ryimage)
+{
+    EPD_3IN52B_DisplayWindowAsync(x, y, w, h, blackimage, ryimage, NULL);
+    EPD_3IN52B_WaitIdle();
+}
+
+/******************************************************************************
+function :	Plane bytes sent to the controller since the last call
+parameter:
+******************************************************************************/
+UDOUBLE EPD_3IN52B_TakeBytesSent(void)
+{
+    UDOUBLE Sent = EPD_3IN52B_BytesSent;
+    EPD_3IN52B_BytesSent = 0;
+    return Sent;
+}
+
+/******************************************************************************
+function :	Clear screen
+parameter:
+******************************************************************************/
+void EPD_3IN52B_Clear(void)
+{
+    EPD_3IN52B_WaitIdle();
+    EPD_3IN52B_SetLut(EPD_3IN52B_LUT_OTP);
+    EPD_3IN52B_SendPlane(0x10, NULL);
+    EPD_3IN52B_SendPlane(0x13, NULL);
 
     EPD_3IN52B_TurnOnDisplay();
 }
@@ -215,8 +558,10 @@ parameter:
 ******************************************************************************/
 void EPD_3IN52B_sleep(void)
 {
+    EPD_3IN52B_WaitIdle();
     EPD_3IN52B_SendCommand(0X07);  	//deep sleep
     EPD_3IN52B_SendData(0xA5);
+    EPD_3IN52B_PlanesValid = 0;
 }
 
 
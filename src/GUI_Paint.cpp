@@ -76,6 +76,7 @@
 *
 ******************************************************************************/
 #include "GUI_Paint.h"
+#include "GUI_Canvas.h"
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h> //memset()
@@ -115,6 +116,8 @@ void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD
         Paint.Width = Height;
         Paint.Height = Width;
     }
+
+    Paint_ResetDirty();
 }
 
 /******************************************************************************
@@ -179,61 +182,91 @@ void Paint_SetScale(UBYTE scale)
     }
 }
 /******************************************************************************
-function: Draw Pixels
-parameter:
-    Xpoint : At point X
-    Ypoint : At point Y
-    Color  : Painted colors
+function: Screen to memory coordinates for the selected rotation and mirror
+info: Returns 0 if the point is outside the image
 ******************************************************************************/
-void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+static UBYTE Paint_MapPoint(UWORD Xpoint, UWORD Ypoint, UWORD *X, UWORD *Y)
 {
-    if(Xpoint > Paint.Width || Ypoint > Paint.Height){
-        Debug("Exceeding display boundaries\r\n");
-        return;
-    }      
-    UWORD X, Y;
     switch(Paint.Rotate) {
     case 0:
-        X = Xpoint;
-        Y = Ypoint;  
+        *X = Xpoint;
+        *Y = Ypoint;  
         break;
     case 90:
-        X = Paint.WidthMemory - Ypoint - 1;
-        Y = Xpoint;
+        *X = Paint.WidthMemory - Ypoint - 1;
+        *Y = Xpoint;
         break;
     case 180:
-        X = Paint.WidthMemory - Xpoint - 1;
-        Y = Paint.HeightMemory - Ypoint - 1;
+        *X = Paint.WidthMemory - Xpoint - 1;
+        *Y = Paint.HeightMemory - Ypoint - 1;
         break;
     case 270:
-        X = Ypoint;
-        Y = Paint.HeightMemory - Xpoint - 1;
+        *X = Ypoint;
+        *Y = Paint.HeightMemory - Xpoint - 1;
         break;
     default:
-        return;
+        return 0;
     }
     
     switch(Paint.Mirror) {
     case MIRROR_NONE:
         break;
     case MIRROR_HORIZONTAL:
-        X = Paint.WidthMemory - X - 1;
+        *X = Paint.WidthMemory - *X - 1;
         break;
     case MIRROR_VERTICAL:
-        Y = Paint.HeightMemory - Y - 1;
+        *Y = Paint.HeightMemory - *Y - 1;
         break;
     case MIRROR_ORIGIN:
-        X = Paint.WidthMemory - X - 1;
-        Y = Paint.HeightMemory - Y - 1;
+        *X = Paint.WidthMemory - *X - 1;
+        *Y = Paint.HeightMemory - *Y - 1;
         break;
     default:
-        return;
+        return 0;
     }
 
-    if(X > Paint.WidthMemory || Y > Paint.HeightMemory){
+    return *X < Paint.WidthMemory && *Y < Paint.HeightMemory;
+}
+
+/******************************************************************************
+function: Screen rectangle (end exclusive) to inclusive memory bounds
+info: Clips to the image, returns 0 if nothing is left
+******************************************************************************/
+static UBYTE Paint_MapWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                             UWORD *X0, UWORD *Y0, UWORD *X1, UWORD *Y1)
+{
+    if (Xend > Paint.Width) Xend = Paint.Width;
+    if (Yend > Paint.Height) Yend = Paint.Height;
+    UWORD Xa, Ya, Xb, Yb;
+    if (Xstart >= Xend || Ystart >= Yend ||
+        !Paint_MapPoint(Xstart, Ystart, &Xa, &Ya) || !Paint_MapPoint(Xend - 1, Yend - 1, &Xb, &Yb))
+        return 0;
+    *X0 = Xa < Xb ? Xa : Xb;
+    *X1 = Xa < Xb ? Xb : Xa;
+    *Y0 = Ya < Yb ? Ya : Yb;
+    *Y1 = Ya < Yb ? Yb : Ya;
+    return 1;
+}
+
+/******************************************************************************
+function: Draw Pixels
+parameter:
+    Xpoint : At point X
+    Ypoint : At point Y
+    Color  : Painted colors
+******************************************************************************/
+void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    if (Canvas_Rotate90::Matches()) {
+        Canvas_Rotate90::SetPixel(Xpoint, Ypoint, Color);
+        return;
+    }
+    UWORD X, Y;
+    if(Xpoint > Paint.Width || Ypoint > Paint.Height || !Paint_MapPoint(Xpoint, Ypoint, &X, &Y)){
         Debug("Exceeding display boundaries\r\n");
         return;
     }
+    Paint_MarkDirty(X, Y);
     
     if(Paint.Scale == 2){
         UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
@@ -265,28 +298,22 @@ parameter:
 ******************************************************************************/
 void Paint_Clear(UWORD Color)
 {
+    if (Canvas_Rotate90::Matches()) {
+        Canvas_Rotate90::Clear(Color);
+        return;
+    }
+    UBYTE Fill;
     if(Paint.Scale == 2) {
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = Color;
-			}
-		}
+        Fill = Color;
     }else if(Paint.Scale == 4) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-            for (UWORD X = 0; X < Paint.WidthByte; X++ ) {
-                UDOUBLE Addr = X + Y*Paint.WidthByte;
-                Paint.Image[Addr] = (Color<<6)|(Color<<4)|(Color<<2)|Color;
-            }
-        }
+        Fill = (Color<<6)|(Color<<4)|(Color<<2)|Color;
     }else if(Paint.Scale == 6 || Paint.Scale == 7 || Paint.Scale == 16) {
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = (Color<<4)|Color;
-			}
-		}		
-	}
+        Fill = (Color<<4)|Color;
+    }else {
+        return;
+    }
+    Paint_MarkAllDirty();
+    memset(Paint.Image, Fill, (UDOUBLE)Paint.WidthByte * Paint.HeightByte);
 }
 
 /******************************************************************************
@@ -297,10 +324,23 @@ parameter:
     Xend   : x end point
     Yend   : y end point
     Color  : Painted colors
+info:
+    1-bit images are filled a memory row at a time with masked edge bytes
+    and memset between, in any rotation.
 ******************************************************************************/
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
 {
+    if (Canvas_Rotate90::Matches()) {
+        Canvas_Rotate90::ClearWindows(Xstart, Ystart, Xend, Yend, Color);
+        return;
+    }
     UWORD X, Y;
+    if (Paint.Scale == 2) {
+        UWORD X1, Y1;
+        if (Paint_MapWindow(Xstart, Ystart, Xend, Yend, &X, &Y, &X1, &Y1))
+            Paint_FillMemory(X, Y, X1, Y1, Color, 0);
+        return;
+    }
     for (Y = Ystart; Y < Yend; Y++) {
         for (X = Xstart; X < Xend; X++) {//8 pixel =  1 byte
             Paint_SetPixel(X, Y, Color);
@@ -308,6 +348,109 @@ void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWOR
     }
 }
 
+/******************************************************************************
+function: Invert the pixels of a window (1-bit images)
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point
+    Yend   : y end point
+******************************************************************************/
+void Paint_InvertWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    if (Canvas_Rotate90::Matches()) {
+        Canvas_Rotate90::InvertWindows(Xstart, Ystart, Xend, Yend);
+        return;
+    }
+    if (Paint.Scale != 2) {
+        Debug("Paint_InvertWindows only supports scale 2\r\n");
+        return;
+    }
+    UWORD X0, Y0, X1, Y1;
+    if (Paint_MapWindow(Xstart, Ystart, Xend, Yend, &X0, &Y0, &X1, &Y1))
+        Paint_FillMemory(X0, Y0, X1, Y1, WHITE, 1);
+}
+
+/******************************************************************************
+function: Forget the dirty region (e.g. after the frame went to the panel)
+******************************************************************************/
+void Paint_ResetDirty(void)
+{
+    Paint.DirtyXstart = 0xFFFF;
+    Paint.DirtyYstart = 0xFFFF;
+    Paint.DirtyXend = 0;
+    Paint.DirtyYend = 0;
+}
+
+/******************************************************************************
+function: Get the region touched since the last Paint_ResetDirty()
+parameter:
+    Rect : Receives the region in memory coordinates
+return:
+    FALSE if nothing was drawn
+******************************************************************************/
+UBYTE Paint_GetDirtyRect(PAINT_RECT *Rect)
+{
+    if (Paint.DirtyXstart >= Paint.DirtyXend || Paint.DirtyYstart >= Paint.DirtyYend) {
+        Rect->Xstart = Rect->Ystart = Rect->Xend = Rect->Yend = 0;
+        return FALSE;
+    }
+    Rect->Xstart = Paint.DirtyXstart;
+    Rect->Ystart = Paint.DirtyYstart;
+    Rect->Xend = Paint.DirtyXend;
+    Rect->Yend = Paint.DirtyYend;
+    return TRUE;
+}
+
+/******************************************************************************
+function: Narrow a region to the bytes that differ between two frames
+parameter:
+    image    : Current frame (same geometry as the selected image)
+    previous : Frame currently shown on the panel
+    Rect     : In: region to compare, out: byte-aligned bounding box of the
+               differing bytes
+return:
+    FALSE if both frames are identical inside the region
+******************************************************************************/
+UBYTE Paint_DiffRect(const UBYTE *image, const UBYTE *previous, PAINT_RECT *Rect)
+{
+    UWORD ppb = (Paint.Scale == 2)? 8 : (Paint.Scale == 4)? 4 : 2; // pixels per byte
+    UWORD Xbyte_start = Rect->Xstart / ppb;
+    UWORD Xbyte_end = (Rect->Xend + ppb - 1) / ppb;
+    UWORD Ystart = Rect->Ystart;
+    UWORD Yend = Rect->Yend;
+    if (Xbyte_end > Paint.WidthByte) Xbyte_end = Paint.WidthByte;
+    if (Yend > Paint.HeightByte) Yend = Paint.HeightByte;
+
+    UWORD Xmin = 0xFFFF, Xmax = 0, Ymin = 0xFFFF, Ymax = 0;
+    for (UWORD Y = Ystart; Y < Yend; Y++) {
+        const UBYTE *row = image + (UDOUBLE)Y * Paint.WidthByte;
+        const UBYTE *prow = previous + (UDOUBLE)Y * Paint.WidthByte;
+        if (memcmp(row + Xbyte_start, prow + Xbyte_start, Xbyte_end - Xbyte_start) == 0)
+            continue; // identical row, e.g. an unchanged text line
+
+        UWORD X = Xbyte_start;
+        while (row[X] == prow[X]) X++;
+        if (X < Xmin) Xmin = X;
+        X = Xbyte_end - 1;
+        while (row[X] == prow[X]) X--;
+        if (X > Xmax) Xmax = X;
+
+        if (Y < Ymin) Ymin = Y;
+        Ymax = Y;
+    }
+
+    if (Ymin == 0xFFFF) {
+        Rect->Xstart = Rect->Ystart = Rect->Xend = Rect->Yend = 0;
+        return FALSE;
+    }
+    Rect->Xstart = Xmin * ppb;
+    Rect->Xend = (Xmax + 1) * ppb;
+    Rect->Ystart = Ymin;
+    Rect->Yend = Ymax + 1;
+    return TRUE;
+}
+
 /******************************************************************************
 function: Draw Point(Xpoint, Ypoint) Fill the color
 parameter:
@@ -422,7 +565,10 @@ void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
         return;
     }
 
-    if (Draw_Fill) {
+    if (Draw_Fill && Line_width == DOT_PIXEL_1X1) {
+        // The rows below draw Xstart..Xend for Ystart..Yend-1
+        Paint_ClearWindows(Xstart, Ystart, Xend + 1, Yend, Color);
+    } else if (Draw_Fill) {
         UWORD Ypoint;
         for(Ypoint = Ystart; Ypoint < Yend; Ypoint++) {
             Paint_DrawLine(Xstart, Ypoint, Xend, Ypoint, Color , Line_width, LINE_STYLE_SOLID);
@@ -505,6 +651,131 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
     }
 }
 
+/******************************************************************************
+function:	Decode one glyph into a bit mask per column
+parameter:
+    Acsii_Char : Character to decode
+    Font       : Bitmap or span font, at most 32x32
+    Columns    : Font->Width masks, bit r = glyph row r
+info:
+    Returns the OR of all columns (0 = no ink). Characters a span font does
+    not contain decode as an empty glyph.
+******************************************************************************/
+static uint32_t Paint_GlyphColumns(const char Acsii_Char, sFONT* Font, uint32_t *Columns)
+{
+    uint32_t Rows = 0;
+    memset(Columns, 0, Font->Width * sizeof(Columns[0]));
+
+    if (Font->Spans) {
+        UBYTE Index = (UBYTE)Acsii_Char - Font->FirstChar;
+        if ((UBYTE)Acsii_Char < Font->FirstChar || Index >= Font->CharCount)
+            return 0;
+
+        // Runs per column, see tools/fontc/fontc.py for the encoding
+        const uint8_t *Span = Font->Spans + Font->SpanIndex[Index];
+        for (UWORD Column = 0; Column < Font->Width; Column++) {
+            UBYTE Row = 0;
+            for (UBYTE Code = *Span++; Code != 0x00; Code = *Span++) {
+                UBYTE Gap = Code >> 4;
+                UBYTE Length = Code & 0x0F;
+                if (Code == 0xF0) {
+                    Gap = Span[0];
+                    Length = Span[1];
+                    Span += 2;
+                }
+                Row += Gap;
+                Columns[Column] |= (Length >= 32 ? 0xFFFFFFFFUL : ((1UL << Length) - 1)) << Row;
+                Row += Length;
+            }
+            Rows |= Columns[Column];
+        }
+        return Rows;
+    }
+
+    UWORD Width_Byte = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+    const unsigned char *ptr = &Font->table[(Acsii_Char - ' ') * Font->Height * Width_Byte];
+
+    // Transpose 8x8 blocks: rows Page..Page+7 of one font byte become one
+    // byte per column, lowest bit = topmost row
+    for (UWORD Page = 0; Page < Font->Height; Page += 8) {
+        for (UWORD i = 0; i < Width_Byte; i++) {
+            uint64_t Block = 0;
+            for (UWORD k = 0; k < 8 && Page + k < Font->Height; k++)
+                Block |= (uint64_t)ptr[(Page + k) * Width_Byte + i] << (8 * k);
+            if (!Block)
+                continue;
+            uint64_t t;
+            t = (Block ^ (Block >> 7)) & 0x00AA00AA00AA00AAULL;
+            Block ^= t ^ (t << 7);
+            t = (Block ^ (Block >> 14)) & 0x0000CCCC0000CCCCULL;
+            Block ^= t ^ (t << 14);
+            t = (Block ^ (Block >> 28)) & 0x00000000F0F0F0F0ULL;
+            Block ^= t ^ (t << 28);
+            for (UWORD k = 0; k < 8 && i * 8 + k < Font->Width; k++) {
+                uint32_t Bits = (uint32_t)((Block >> (56 - 8 * k)) & 0xFF) << Page;
+                Columns[i * 8 + k] |= Bits;
+                Rows |= Bits;
+            }
+        }
+    }
+    return Rows;
+}
+
+/******************************************************************************
+function:	Glyph blitter for 1-bit images drawn with ROTATE_90 and no mirror
+parameter:
+    Xpoint, Ypoint   : Top left of the glyph, fully inside the image
+    Columns, Rows    : The glyph from Paint_GlyphColumns()
+info:
+    With ROTATE_90 every glyph column lands in a single memory row, with glyph
+    row 0 at the highest memory X. Each column's runs are written with masked
+    byte stores instead of a rotate/mirror/read-modify-write round trip per
+    pixel.
+******************************************************************************/
+static void Paint_DrawChar_Rotate90(UWORD Xpoint, UWORD Ypoint, const uint32_t *Columns, uint32_t Rows,
+                                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    // Memory X of glyph row 0 and the byte-aligned start of the run
+    UWORD X_Top = Paint.WidthMemory - Ypoint - 1;
+    UWORD X_Bottom = X_Top - (Font->Height - 1);
+    UWORD X_Base = X_Bottom & ~7;
+    UBYTE Shift = 63 - (X_Top - X_Base);
+    UWORD Bytes = X_Top / 8 - X_Base / 8 + 1;
+    uint64_t Run = (uint64_t)(Font->Height == 32 ? 0xFFFFFFFFUL : ((1UL << Font->Height) - 1)) << Shift;
+    UBYTE Opaque = (FONT_BACKGROUND != Color_Background);
+    UBYTE Fore_Set = (Color_Foreground != BLACK);
+    UBYTE Back_Set = (Color_Background != BLACK);
+
+    if (Opaque) {
+        Paint_MarkDirty(X_Bottom, Xpoint);
+        Paint_MarkDirty(X_Top, Xpoint + Font->Width - 1);
+    } else if (Rows) {
+        UWORD First = 0, Last = Font->Width - 1;
+        while (!Columns[First]) First++;
+        while (!Columns[Last]) Last--;
+        Paint_MarkDirty(X_Top - (31 - __builtin_clz(Rows)), Xpoint + First);
+        Paint_MarkDirty(X_Top - __builtin_ctz(Rows), Xpoint + Last);
+    }
+
+    UBYTE *Row = Paint.Image + X_Base / 8 + (UDOUBLE)Xpoint * Paint.WidthByte;
+    for (UWORD Column = 0; Column < Font->Width; Column++, Row += Paint.WidthByte) {
+        uint64_t Ink = (uint64_t)Columns[Column] << Shift;
+        if (!Opaque && !Ink)
+            continue;
+        for (UWORD i = 0; i < Bytes; i++) {
+            UBYTE Mask = Ink >> (56 - 8 * i);
+            if (Opaque) {
+                UBYTE Area = Run >> (56 - 8 * i);
+                Row[i] = (Row[i] & ~Area) | (Fore_Set ? Mask : 0) | (Back_Set ? (Area & ~Mask) : 0);
+            } else if (Fore_Set) {
+                Row[i] |= Mask;
+            } else {
+                Row[i] &= ~Mask;
+            }
+        }
+    }
+}
+
 /******************************************************************************
 function: Show English characters
 parameter:
@@ -525,6 +796,30 @@ void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
         return;
     }
 
+    uint32_t Columns[32];
+    if (Canvas_Rotate90::Matches() && Font->Height <= 32 && Font->Width <= 32 &&
+        Xpoint + Font->Width <= Paint.Width && Ypoint + Font->Height <= Paint.Height) {
+        uint32_t Rows = Paint_GlyphColumns(Acsii_Char, Font, Columns);
+        Paint_DrawChar_Rotate90(Xpoint, Ypoint, Columns, Rows, Font, Color_Foreground, Color_Background);
+        return;
+    }
+
+    if (Font->Spans) {
+        // Other orientations and clipped glyphs: pixel by pixel from the columns
+        if (Font->Height > 32 || Font->Width > 32)
+            return;
+        Paint_GlyphColumns(Acsii_Char, Font, Columns);
+        if (FONT_BACKGROUND != Color_Background)
+            Paint_ClearWindows(Xpoint, Ypoint, Xpoint + Font->Width, Ypoint + Font->Height, Color_Background);
+        for (Page = 0; Page < Font->Height; Page ++ ) {
+            for (Column = 0; Column < Font->Width; Column ++ ) {
+                if (Columns[Column] & (1UL << Page))
+                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
+            }
+        }
+        return;
+    }
+
     uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
     const unsigned char *ptr = &Font->table[Char_Offset];
 
@@ -554,6 +849,125 @@ void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
     }// Write all
 }
 
+/******************************************************************************
+function:	Pre-rotate glyphs for Paint_SpritesStamp()
+parameter:
+    Sprites          : Cache to fill
+    Font             : At most 32x32
+    Chars            : Characters to cache, at most PAINT_SPRITES_MAX_CHARS
+    Ypoint           : Screen row the string will be stamped at
+    Color_Foreground : Ink
+    Color_Background : Rest of the cell, cells are always opaque
+info:
+    Uses the geometry of the selected image, which must match Canvas_Rotate90.
+    Returns 0 (and leaves Sprites unusable) if it does not or the font or
+    characters do not fit.
+******************************************************************************/
+UBYTE Paint_SpritesInit(PAINT_SPRITES *Sprites, sFONT* Font, const char *Chars, UWORD Ypoint,
+                        UWORD Color_Foreground, UWORD Color_Background)
+{
+    size_t Count = strlen(Chars);
+    Sprites->Font = NULL;
+    if (!Canvas_Rotate90::Matches() || Count > PAINT_SPRITES_MAX_CHARS ||
+        Font->Width > PAINT_SPRITES_MAX_WIDTH || Font->Height > 32 || Ypoint + Font->Height > Paint.Height)
+        return 0;
+
+    // Same placement as Paint_DrawChar_Rotate90()
+    UWORD X_Top = Paint.WidthMemory - Ypoint - 1;
+    UWORD X_Base = (X_Top - (Font->Height - 1)) & ~7;
+    UBYTE Shift = 63 - (X_Top - X_Base);
+    uint64_t Run = (uint64_t)(Font->Height == 32 ? 0xFFFFFFFFUL : ((1UL << Font->Height) - 1)) << Shift;
+    UBYTE Fore_Set = (Color_Foreground != BLACK);
+    UBYTE Back_Set = (Color_Background != BLACK);
+
+    Sprites->Bytes = X_Top / 8 - X_Base / 8 + 1;
+    Sprites->ByteStart = X_Base / 8;
+    for (UBYTE i = 0; i < Sprites->Bytes; i++)
+        Sprites->Area[i] = Run >> (56 - 8 * i);
+
+    uint32_t Columns[32];
+    for (size_t c = 0; c < Count; c++) {
+        Paint_GlyphColumns(Chars[c], Font, Columns);
+        for (UWORD Column = 0; Column < Font->Width; Column++) {
+            uint64_t Ink = (uint64_t)Columns[Column] << Shift;
+            for (UBYTE i = 0; i < Sprites->Bytes; i++) {
+                UBYTE Mask = Ink >> (56 - 8 * i);
+                Sprites->Cells[c][Column][i] = (Fore_Set ? Mask : 0) | (Back_Set ? (Sprites->Area[i] & ~Mask) : 0);
+            }
+        }
+    }
+
+    memcpy(Sprites->Chars, Chars, Count + 1);
+    Sprites->Ypoint = Ypoint;
+    Sprites->Color_Foreground = Color_Foreground;
+    Sprites->Color_Background = Color_Background;
+    Sprites->WidthMemory = Paint.WidthMemory;
+    Sprites->Font = Font;
+    return 1;
+}
+
+/******************************************************************************
+function:	Stamp a string from a sprite cache, one cell per character
+parameter:
+    Sprites : Filled by Paint_SpritesInit()
+    Xstart  : Screen column of the first cell
+    pString : Characters to stamp
+info:
+    A cell that already shows its character is neither written nor marked
+    dirty, so restamping "12:34" over "12:33" only touches the last cell.
+    Characters without a sprite are drawn opaque through Paint_DrawChar().
+    Returns the number of cells written.
+******************************************************************************/
+UBYTE Paint_SpritesStamp(const PAINT_SPRITES *Sprites, UWORD Xstart, const char *pString)
+{
+    sFONT *Font = Sprites->Font;
+    UBYTE Stamped = 0;
+    if (Font == NULL)
+        return 0;
+
+    UBYTE Usable = Canvas_Rotate90::Matches() && Paint.WidthMemory == Sprites->WidthMemory;
+    UWORD Ypoint = Sprites->Ypoint;
+    UWORD X_Top = Paint.WidthMemory - Ypoint - 1;
+    UWORD Cell_Bytes = Sprites->Bytes;
+
+    for (UWORD Xpoint = Xstart; *pString != '\0'; pString++, Xpoint += Font->Width) {
+        if (Xpoint + Font->Width > Paint.Width)
+            break;
+
+        const char *Sprite = Usable ? strchr(Sprites->Chars, *pString) : NULL;
+        if (Sprite == NULL) {
+            Paint_ClearWindows(Xpoint, Ypoint, Xpoint + Font->Width, Ypoint + Font->Height, Sprites->Color_Background);
+            Paint_DrawChar(Xpoint, Ypoint, *pString, Font, Sprites->Color_Foreground, Sprites->Color_Background);
+            Stamped++;
+            continue;
+        }
+
+        const UBYTE (*Cell)[PAINT_SPRITES_MAX_BYTES] = Sprites->Cells[Sprite - Sprites->Chars];
+        UBYTE *Row = Paint.Image + Sprites->ByteStart + (UDOUBLE)Xpoint * Paint.WidthByte;
+        UBYTE Same = 1;
+        for (UWORD Column = 0; Column < Font->Width && Same; Column++) {
+            const UBYTE *Bytes = Row + (UDOUBLE)Column * Paint.WidthByte;
+            for (UWORD i = 0; i < Cell_Bytes; i++) {
+                if ((Bytes[i] & Sprites->Area[i]) != Cell[Column][i]) {
+                    Same = 0;
+                    break;
+                }
+            }
+        }
+        if (Same)
+            continue;
+
+        for (UWORD Column = 0; Column < Font->Width; Column++, Row += Paint.WidthByte) {
+            for (UWORD i = 0; i < Cell_Bytes; i++)
+                Row[i] = (Row[i] & ~Sprites->Area[i]) | Cell[Column][i];
+        }
+        Paint_MarkDirty(X_Top - (Font->Height - 1), Xpoint);
+        Paint_MarkDirty(X_Top, Xpoint + Font->Width - 1);
+        Stamped++;
+    }
+    return Stamped;
+}
+
 /******************************************************************************
 function:	Display the string
 parameter:
@@ -597,6 +1011,148 @@ void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
     }
 }
 
+/******************************************************************************
+function:	Append one line to a layout, fails once the layout is full
+******************************************************************************/
+static UBYTE Paint_LayoutPush(PAINT_LAYOUT *Layout, const char *Start, UWORD Length, UWORD MaxHeight)
+{
+    UWORD Top = Layout->LineCount * Layout->LineHeight;
+    if (Layout->LineCount >= PAINT_LAYOUT_MAX_LINES || Top + Layout->Font->Height > MaxHeight) {
+        Layout->Truncated = 1;
+        return 0;
+    }
+
+    PAINT_LINE *Line = &Layout->Lines[Layout->LineCount++];
+    Line->Start = Start;
+    Line->Length = Length;
+    if (Length * Layout->Font->Width > Layout->Width)
+        Layout->Width = Length * Layout->Font->Width;
+    Layout->Height = Top + Layout->Font->Height;
+    return 1;
+}
+
+/******************************************************************************
+function:	Break a string into lines without drawing anything
+parameter:
+    pString          : The ASCII text to measure
+    Font             : A pointer to the font structure
+    MaxWidth         : Width available to each line in pixels
+    MaxHeight        : Height available to all lines in pixels
+    lineSpacing      : Extra spacing (in pixels) between lines
+    Layout           : Receives the line table
+return:
+    1 if the whole text fits, 0 if it was truncated
+info:
+    Words are separated by spaces, '\n' forces a break. A word moves to the
+    next line when it does not fit, words longer than a line are split.
+******************************************************************************/
+UBYTE Paint_MeasureText(const char *pString, sFONT* Font, UWORD MaxWidth, UWORD MaxHeight,
+                        UWORD lineSpacing, PAINT_LAYOUT *Layout)
+{
+    Layout->Font = Font;
+    Layout->LineHeight = Font->Height + lineSpacing;
+    Layout->Width = 0;
+    Layout->Height = 0;
+    Layout->LineCount = 0;
+    Layout->Truncated = 0;
+
+    UWORD MaxChars = MaxWidth / Font->Width;
+    if (MaxChars == 0) {
+        Layout->Truncated = (*pString != '\0');
+        return !Layout->Truncated;
+    }
+
+    const char *p = pString;
+    const char *Line = NULL; // Start of the line being filled
+    UWORD Length = 0;
+    while (*p != '\0') {
+        if (*p == ' ') {
+            p++;
+            continue;
+        }
+        if (*p == '\n') {
+            if (!Paint_LayoutPush(Layout, Line ? Line : p, Length, MaxHeight))
+                return 0;
+            Line = NULL;
+            Length = 0;
+            p++;
+            continue;
+        }
+
+        const char *Word = p;
+        while (*p != '\0' && *p != ' ' && *p != '\n')
+            p++;
+        UWORD WordLength = p - Word;
+
+        // Extend the current line up to the end of this word if it still fits
+        if (Line && (size_t)(p - Line) <= MaxChars) {
+            Length = p - Line;
+            continue;
+        }
+        if (Line && !Paint_LayoutPush(Layout, Line, Length, MaxHeight))
+            return 0;
+
+        // The word starts a new line, split it if it is longer than one
+        while (WordLength > MaxChars) {
+            if (!Paint_LayoutPush(Layout, Word, MaxChars, MaxHeight))
+                return 0;
+            Word += MaxChars;
+            WordLength -= MaxChars;
+        }
+        Line = Word;
+        Length = WordLength;
+    }
+    if (Line && !Paint_LayoutPush(Layout, Line, Length, MaxHeight))
+        return 0;
+    return 1;
+}
+
+/******************************************************************************
+function:	Pick the first font the text fits in
+parameter:
+    Fonts            : Candidate fonts, largest first
+    FontCount        : Number of candidates
+    others           : See Paint_MeasureText()
+return:
+    The chosen font, Layout holds its line table. If nothing fits this is the
+    last font with a truncated layout.
+******************************************************************************/
+sFONT *Paint_FitText(const char *pString, sFONT **Fonts, UBYTE FontCount, UWORD MaxWidth, UWORD MaxHeight,
+                     UWORD lineSpacing, PAINT_LAYOUT *Layout)
+{
+    for (UBYTE i = 0; i < FontCount; i++) {
+        if (Paint_MeasureText(pString, Fonts[i], MaxWidth, MaxHeight, lineSpacing, Layout))
+            return Fonts[i];
+    }
+    return FontCount ? Layout->Font : NULL;
+}
+
+/******************************************************************************
+function:	Draw a line table built by Paint_MeasureText()
+parameter:
+    Xstart           : X coordinate of the first line
+    Ystart           : Y coordinate of the first line
+    Layout           : The measured text
+    Color_Foreground : Foreground color
+    Color_Background : Background color
+******************************************************************************/
+void Paint_DrawLayout(UWORD Xstart, UWORD Ystart, const PAINT_LAYOUT *Layout,
+                      UWORD Color_Foreground, UWORD Color_Background)
+{
+    sFONT *Font = Layout->Font;
+    for (UWORD i = 0; i < Layout->LineCount; i++) {
+        const PAINT_LINE *Line = &Layout->Lines[i];
+        UWORD Xpoint = Xstart;
+        UWORD Ypoint = Ystart + i * Layout->LineHeight;
+        for (UWORD n = 0; n < Line->Length; n++, Xpoint += Font->Width) {
+            // A space leaves a transparent background untouched
+            if (Line->Start[n] == ' ' && Color_Foreground == FONT_BACKGROUND)
+                continue;
+            Paint_DrawChar(Xpoint, Ypoint, Line->Start[n], Font, Color_Background, Color_Foreground);
+        }
+    }
+}
+
 /******************************************************************************
 function:	Display the string (word-wrapped)
 parameter:
@@ -607,85 +1163,22 @@ parameter:
     Color_Foreground : Foreground color
     Color_Background : Background color
     lineSpacing      : Extra spacing (in pixels) between lines
+info:
+    Lines end 5 pixels before the right edge, text that runs out of vertical
+    space is cut off. Use Paint_MeasureText() to find out beforehand.
 ******************************************************************************/
 void Paint_DrawString_EN_WordWrap(UWORD Xstart, UWORD Ystart, const char *pString,
                                   sFONT* Font, UWORD Color_Foreground, UWORD Color_Background,
                                   UWORD lineSpacing)
 {
-    // A buffer for the entire string (avoid modifying the original)
-    // Ensure the buffer is large enough for your use-case
-    char tempBuffer[1024];
-    strncpy(tempBuffer, pString, sizeof(tempBuffer) - 1);
-    tempBuffer[sizeof(tempBuffer) - 1] = '\0';
-
-    // Split tempBuffer into words using strtok or a custom method
-    // We assume words are separated by spaces. You could handle newlines or punctuation too.
-    char *word = strtok(tempBuffer, " ");
-    if(!word) {
-        return; // no text
+    if (Xstart + 5 >= Paint.Width || Ystart > Paint.Height) {
+        Debug("Paint_DrawString_EN_WordWrap Input exceeds the normal display range\r\n");
+        return;
     }
 
-    UWORD Xpoint = Xstart;
-    UWORD Ypoint = Ystart;
-
-    // The effective line height includes the Font->Height plus any extra spacing
-    UWORD effectiveLineHeight = Font->Height + lineSpacing;
-
-    while(word != NULL) {
-        // Measure the width of this word (including one trailing space, if you want)
-        // For simplicity, let's add a space width only if the next word isn't null
-        // but you can do more advanced spacing logic if desired.
-        UWORD wordLength = strlen(word);
-        UWORD wordWidth = wordLength * Font->Width;
-
-        // If there's another word after this, you might want to add Font->Width for the trailing space
-        // But for demonstration, let's do a single space. We'll do that after drawing the word below.
-
-        // Check if the word fits in the current line
-        // If not, wrap to next line
-        if ((Xpoint + wordWidth) > Paint.Width - 5) {
-            // Go to new line
-            Xpoint = Xstart;
-            Ypoint += effectiveLineHeight;
-
-            // If we're out of vertical space, break
-            if (Ypoint + Font->Height > Paint.Height) {
-                break;
-            }
-        }
-
-        // Draw the word
-        // We'll draw each character in the word
-        // (re-using your Paint_DrawChar or Paint_DrawString logic at the character level)
-        const char *pChar = word;
-        while(*pChar != '\0') {
-            // Ensure we still fit horizontally
-            if((Xpoint + Font->Width) > Paint.Width - 5) {
-                // Wrap line
-                Xpoint = Xstart;
-                Ypoint += effectiveLineHeight;
-                if (Ypoint + Font->Height > Paint.Height) {
-                    break; // no more space
-                }
-            }
-
-            // Draw one character
-            Paint_DrawChar(Xpoint, Ypoint, *pChar, Font, Color_Background, Color_Foreground);
-            Xpoint += Font->Width;
-            pChar++;
-        }
-
-        // Optionally add a space after the word (unless it's the last word).
-        // Check if there's a next word by peeking the next token, or re-calling strtok without advancing.
-        // Simpler: always add a space if we still have horizontal space
-        if ((Xpoint + Font->Width) <= Paint.Width) {
-            Paint_DrawChar(Xpoint, Ypoint, ' ', Font, Color_Background, Color_Foreground);
-            Xpoint += Font->Width;
-        }
-
-        // Next word
-        word = strtok(NULL, " ");
-    }
+    PAINT_LAYOUT Layout;
+    Paint_MeasureText(pString, Font, Paint.Width - 5 - Xstart, Paint.Height - Ystart, lineSpacing, &Layout);
+    Paint_DrawLayout(Xstart, Ystart, &Layout, Color_Foreground, Color_Background);
 }
 
 /******************************************************************************
@@ -882,6 +1375,8 @@ void Paint_DrawBitMap(const unsigned char* image_buffer)
     UWORD x, y;
     UDOUBLE Addr = 0;
 
+    Paint_MarkAllDirty();
+
     for (y = 0; y < Paint.HeightByte; y++) {
         for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
             Addr = x + y * Paint.WidthByte;
@@ -935,6 +1430,10 @@ void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD ySta
 	UWORD w_byte=(W_Image%8)?(W_Image/8)+1:W_Image/8;
     UDOUBLE Addr = 0;
 	UDOUBLE pAddr = 0;
+    if (W_Image > 0 && H_Image > 0) {
+        Paint_MarkDirty(xStart, yStart);
+        Paint_MarkDirty(xStart + W_Image - 1, yStart + H_Image - 1);
+    }
     for (y = 0; y < H_Image; y++) {
         for (x = 0; x < w_byte; x++) {//8 pixel =  1 byte
             Addr = x + y * w_byte;
@@ -0,0 +1,249 @@
+/******************************************************************************
+* | File      	:   Perf.cpp
+* | Function    :   Phase timers for the awake time of the clock
+* | Info        :
+******************************************************************************/
+#include "Perf.h"
+#include <Arduino.h>
+#include <string.h>
+
+static const char *const Perf_Names[PERF_PHASE_COUNT] = {
+    "verse", "json", "render", "upload", "busy", "wifi", "ntp", "post",
+};
+
+static const char *const Perf_RefreshNames[PERF_REFRESH_COUNT] = {
+    "unchanged", "full", "window", "fast",
+};
+
+RTC_DATA_ATTR static PERF_STATS Perf_Stats[PERF_PHASE_COUNT];
+RTC_DATA_ATTR static PERF_UPLOAD_STATS Perf_Upload;
+
+// Telemetry ring and totals since the last upload. The open cycle lives in
+// normal RAM, a boot starts a new one at esp_timer 0.
+RTC_DATA_ATTR static PERF_CYCLE Perf_Cycles[PERF_CYCLE_SLOTS];
+RTC_DATA_ATTR static uint16_t Perf_CycleFirst;
+RTC_DATA_ATTR static uint16_t Perf_CycleCount;
+RTC_DATA_ATTR static PERF_TELEMETRY Perf_Telemetry;
+static int64_t Perf_CycleStartUs = 0;
+static uint64_t Perf_CycleUs[PERF_PHASE_COUNT];
+static uint8_t Perf_CycleRefreshes[PERF_REFRESH_COUNT];
+// Everything above: the render, panel and net tasks record on both cores
+static portMUX_TYPE Perf_Mux = portMUX_INITIALIZER_UNLOCKED;
+
+void Perf_Record(PERF_PHASE Phase, uint32_t Us)
+{
+    if (Phase >= PERF_PHASE_COUNT)
+        return;
+
+    uint32_t ms = Us / 1000;
+    uint8_t bin = 0;
+    while (ms && bin < PERF_HISTOGRAM_BINS - 1) {
+        ms >>= 1;
+        bin++;
+    }
+
+    portENTER_CRITICAL(&Perf_Mux);
+    PERF_STATS *s = &Perf_Stats[Phase];
+    if (s->Count == 0 || Us < s->MinUs)
+        s->MinUs = Us;
+    if (Us > s->MaxUs)
+        s->MaxUs = Us;
+    s->Count++;
+    s->TotalUs += Us;
+    Perf_CycleUs[Phase] += Us;
+    if (s->Histogram[bin] < 0xFFFF)
+        s->Histogram[bin]++;
+    portEXIT_CRITICAL(&Perf_Mux);
+}
+
+void Perf_RecordUploadBytes(uint32_t Bytes)
+{
+    portENTER_CRITICAL(&Perf_Mux);
+    PERF_UPLOAD_STATS *s = &Perf_Upload;
+    if (s->Frames == 0 || Bytes < s->MinBytes)
+        s->MinBytes = Bytes;
+    if (Bytes > s->MaxBytes)
+        s->MaxBytes = Bytes;
+    s->Frames++;
+    s->TotalBytes += Bytes;
+    portEXIT_CRITICAL(&Perf_Mux);
+}
+
+const PERF_UPLOAD_STATS *Perf_GetUpload(void)
+{
+    return &Perf_Upload;
+}
+
+const PERF_STATS *Perf_Get(PERF_PHASE Phase)
+{
+    return Phase < PERF_PHASE_COUNT ? &Perf_Stats[Phase] : NULL;
+}
+
+const char *Perf_PhaseName(PERF_PHASE Phase)
+{
+    return Phase < PERF_PHASE_COUNT ? Perf_Names[Phase] : "";
+}
+
+const char *Perf_RefreshName(PERF_REFRESH Type)
+{
+    return Type < PERF_REFRESH_COUNT ? Perf_RefreshNames[Type] : "";
+}
+
+void Perf_RecordRefresh(PERF_REFRESH Type)
+{
+    if (Type >= PERF_REFRESH_COUNT)
+        return;
+    portENTER_CRITICAL(&Perf_Mux);
+    if (Perf_CycleRefreshes[Type] < 0xFF)
+        Perf_CycleRefreshes[Type]++;
+    portEXIT_CRITICAL(&Perf_Mux);
+}
+
+void Perf_EndCycle(uint32_t Time, uint16_t BatteryMv)
+{
+    PERF_CYCLE c;
+    c.Time = Time;
+    c.BatteryMv = BatteryMv;
+
+    // Take and clear the open cycle in one step, other tasks keep recording
+    portENTER_CRITICAL(&Perf_Mux);
+    int64_t Now = esp_timer_get_time();
+    c.AwakeMs = (uint32_t)((Now - Perf_CycleStartUs) / 1000);
+    Perf_CycleStartUs = Now;
+    PERF_TELEMETRY *t = &Perf_Telemetry;
+    for (int i = 0; i < PERF_PHASE_COUNT; i++) {
+        uint64_t ms = Perf_CycleUs[i] / 1000;
+        c.PhaseMs[i] = ms > 0xFFFF ? 0xFFFF : (uint16_t)ms;
+        t->PhaseMs[i] += ms;
+        // The sub-millisecond rest stays with the next cycle
+        Perf_CycleUs[i] -= ms * 1000;
+    }
+    memcpy(c.Refreshes, Perf_CycleRefreshes, sizeof(c.Refreshes));
+    memset(Perf_CycleRefreshes, 0, sizeof(Perf_CycleRefreshes));
+
+    t->Cycles++;
+    t->AwakeMs += c.AwakeMs;
+    for (int i = 0; i < PERF_REFRESH_COUNT; i++)
+        t->Refreshes[i] += c.Refreshes[i];
+    if (BatteryMv && (t->BatteryMinMv == 0 || BatteryMv < t->BatteryMinMv))
+        t->BatteryMinMv = BatteryMv;
+
+    if (Perf_CycleCount == PERF_CYCLE_SLOTS) {
+        Perf_CycleFirst = (Perf_CycleFirst + 1) % PERF_CYCLE_SLOTS;
+        Perf_CycleCount--;
+        t->Dropped++;
+    }
+    Perf_Cycles[(Perf_CycleFirst + Perf_CycleCount) % PERF_CYCLE_SLOTS] = c;
+    Perf_CycleCount++;
+    portEXIT_CRITICAL(&Perf_Mux);
+}
+
+uint16_t Perf_SnapshotTelemetry(PERF_TELEMETRY *Totals, PERF_CYCLE *Cycles, uint16_t Max)
+{
+    portENTER_CRITICAL(&Perf_Mux);
+    *Totals = Perf_Telemetry;
+    uint16_t Count = Perf_CycleCount < Max ? Perf_CycleCount : Max;
+    for (uint16_t i = 0; i < Count; i++)
+        Cycles[i] = Perf_Cycles[(Perf_CycleFirst + i) % PERF_CYCLE_SLOTS];
+    portEXIT_CRITICAL(&Perf_Mux);
+    return Count;
+}
+
+void Perf_TelemetrySent(const PERF_TELEMETRY *Totals, uint16_t Cycles)
+{
+    portENTER_CRITICAL(&Perf_Mux);
+    PERF_TELEMETRY *t = &Perf_Telemetry;
+    t->Cycles -= Totals->Cycles;
+    // Cycles the ring dropped since the snapshot are its oldest, already sent
+    uint32_t Lost = t->Dropped - Totals->Dropped;
+    if (Lost > Cycles)
+        Lost = Cycles;
+    t->Dropped -= Totals->Dropped + Lost;
+    t->AwakeMs -= Totals->AwakeMs;
+    for (int i = 0; i < PERF_PHASE_COUNT; i++)
+        t->PhaseMs[i] -= Totals->PhaseMs[i];
+    for (int i = 0; i < PERF_REFRESH_COUNT; i++)
+        t->Refreshes[i] -= Totals->Refreshes[i];
+
+    Cycles -= Lost;
+    if (Cycles > Perf_CycleCount)
+        Cycles = Perf_CycleCount;
+    Perf_CycleFirst = (Perf_CycleFirst + Cycles) % PERF_CYCLE_SLOTS;
+    Perf_CycleCount -= Cycles;
+
+    // The minimum of the cycles still to send, those since the snapshot
+    t->BatteryMinMv = 0;
+    for (uint16_t i = 0; i < Perf_CycleCount; i++) {
+        uint16_t Mv = Perf_Cycles[(Perf_CycleFirst + i) % PERF_CYCLE_SLOTS].BatteryMv;
+        if (Mv && (t->BatteryMinMv == 0 || Mv < t->BatteryMinMv))
+            t->BatteryMinMv = Mv;
+    }
+    portEXIT_CRITICAL(&Perf_Mux);
+}
+
+void Perf_Reset(void)
+{
+    portENTER_CRITICAL(&Perf_Mux);
+    memset(Perf_Stats, 0, sizeof(Perf_Stats));
+    memset(&Perf_Upload, 0, sizeof(Perf_Upload));
+    portEXIT_CRITICAL(&Perf_Mux);
+}
+
+void Perf_Report(void)
+{
+    // Print from a copy, not inside the critical section
+    PERF_STATS Stats[PERF_PHASE_COUNT];
+    PERF_UPLOAD_STATS Upload;
+    PERF_TELEMETRY Telemetry;
+    uint16_t CycleCount;
+    portENTER_CRITICAL(&Perf_Mux);
+    memcpy(Stats, Perf_Stats, sizeof(Stats));
+    Upload = Perf_Upload;
+    Telemetry = Perf_Telemetry;
+    CycleCount = Perf_CycleCount;
+    portEXIT_CRITICAL(&Perf_Mux);
+
+    Serial.println("phase      count     min ms     avg ms     max ms  histogram (<1, <2, <4 ... ms)");
+    for (int i = 0; i < PERF_PHASE_COUNT; i++) {
+        const PERF_STATS *s = &Stats[i];
+        if (s->Count == 0) {
+            Serial.printf("%-8s %7u\r\n", Perf_Names[i], 0u);
+            continue;
+        }
+        Serial.printf("%-8s %7u %10.1f %10.1f %10.1f ", Perf_Names[i], (unsigned)s->Count,
+                      s->MinUs / 1000.0, (double)s->TotalUs / s->Count / 1000.0, s->MaxUs / 1000.0);
+        // Only the span of bins that were hit
+        int first = 0, last = PERF_HISTOGRAM_BINS - 1;
+        while (s->Histogram[first] == 0) first++;
+        while (s->Histogram[last] == 0) last--;
+        for (int b = first; b <= last; b++)
+            Serial.printf(" %s%lu:%u", b == PERF_HISTOGRAM_BINS - 1 ? ">=" : "<",
+                          b == PERF_HISTOGRAM_BINS - 1 ? 1UL << (b - 1) : 1UL << b, s->Histogram[b]);
+        Serial.println();
+    }
+
+    const PERF_UPLOAD_STATS *u = &Upload;
+    Serial.printf("sent     %7u %8u B %8u B %8u B  per frame\r\n", (unsigned)u->Frames,
+                  (unsigned)u->MinBytes, u->Frames ? (unsigned)(u->TotalBytes / u->Frames) : 0u,
+                  (unsigned)u->MaxBytes);
+
+    const PERF_TELEMETRY *t = &Telemetry;
+    Serial.printf("cycles   %7u pending (%u in ring, %u dropped), refreshes:", (unsigned)t->Cycles,
+                  (unsigned)CycleCount, (unsigned)t->Dropped);
+    for (int i = 0; i < PERF_REFRESH_COUNT; i++)
+        Serial.printf(" %s %u", Perf_RefreshNames[i], (unsigned)t->Refreshes[i]);
+    Serial.println();
+}
+
+void Perf_PollSerial(void)
+{
+    while (Serial.available() > 0) {
+        int c = Serial.read();
+        if (c == 'p') {
+            Perf_Report();
+        } else if (c == 'r') {
+            Perf_Reset();
+            Serial.println("Perf counters reset");
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/******************************************************************************
+* | File      	:   VerseRender.cpp
+* | Function    :   Layout of the clock face (time, book, verse)
+* | Info        :
+*   Keep this free of Arduino-only calls, tools/prerender builds it on the host.
+******************************************************************************/
+#include "VerseRender.h"
+#include <string.h>
+
+size_t VerseRender_BookName(const char *Reference, char *BookName, size_t Len)
+{
+    const char *start = strchr(Reference, '(');
+    const char *end = start ? strchr(start + 1, ')') : NULL;
+    if (!start || !end || Len < 3) {
+        if (Len) BookName[0] = '\0';
+        return 0; // Return empty string if format is unexpected
+    }
+
+    size_t n = end - start - 1;
+    if (n > Len - 3) n = Len - 3;
+    BookName[0] = '[';
+    memcpy(BookName + 1, start + 1, n);
+    BookName[n + 1] = ']';
+    BookName[n + 2] = '\0';
+    return n + 2;
+}
+
+void VerseRender_Header(UBYTE *Red, const char *TimeStr, const char *BookName)
+{
+    // Time digits pre-rotated into the plane's byte layout, built on first use
+    static PAINT_SPRITES timeSprites;
+    static bool timeSpritesReady = false;
+    const int timeY = 10;
+
+    Paint_SelectImage(Red);
+    if (!timeSpritesReady) {
+        timeSpritesReady = Paint_SpritesInit(&timeSprites, &Font32, "0123456789:", timeY, RED, WHITE);
+    }
+    // Draw Time at Top Center with Font32 in Red on White Background
+    int timeFontWidth = Font32.Width * strlen(TimeStr); // Should be 5 for "HH:MM"
+    int timeX = (VERSE_DISPLAY_WIDTH - timeFontWidth) / 2;
+    if (timeSpritesReady) {
+        // Clear around the time cells, the stamp only rewrites digits that changed
+        int timeBottom = timeY + Font32.Height;
+        Paint_ClearWindows(0, 0, Paint.Width, timeY, WHITE);
+        Paint_ClearWindows(0, timeBottom, Paint.Width, Paint.Height, WHITE);
+        Paint_ClearWindows(0, timeY, timeX, timeBottom, WHITE);
+        Paint_ClearWindows(timeX + timeFontWidth, timeY, Paint.Width, timeBottom, WHITE);
+        Paint_SpritesStamp(&timeSprites, timeX, TimeStr);
+    } else {
+        Paint_Clear(WHITE);  // Clear with white background
+        Paint_DrawString_EN(timeX, timeY, TimeStr, &Font32, WHITE, RED);
+    }
+
+    // Draw Reference Book if available
+    if (BookName[0] != '\0') {
+        int refFontWidth = Font20.Width * strlen(BookName); // Includes brackets, e.g., "[John]"
+        int refX = (VERSE_DISPLAY_WIDTH - refFontWidth) / 2; // Center horizontally
+        Paint_DrawString_EN(refX, 50, BookName, &Font20, WHITE, RED);
+    }
+}
+
+void VerseRender_Verse(UBYTE *Black, const char *VerseText, bool HasBookName)
+{
+    // Largest font the whole verse fits in, Font12 (truncated) otherwise
+    static sFONT *verseFonts[] = { &Font24, &Font20, &Font16, &Font12 };
+    static PAINT_LAYOUT layout;
+    int verseX = 10; // Starting X position with some padding
+    int verseY = HasBookName ? 90 : 60; // Adjust Y based on whether reference is present
+    Paint_FitText(VerseText, verseFonts, sizeof(verseFonts) / sizeof(verseFonts[0]),
+                  VERSE_DISPLAY_WIDTH - verseX, VERSE_DISPLAY_HEIGHT - verseY, 2, &layout);
+
+    Paint_SelectImage(Black);
+    Paint_Clear(WHITE);  // Clear with white background
+    Paint_DrawLayout(verseX, verseY, &layout, WHITE, BLACK);
+}
+
+void VerseRender_Frame(UBYTE *Black, UBYTE *Red, const char *TimeStr, const char *BookName, const char *VerseText)
+{
+    VerseRender_Header(Red, TimeStr, BookName);
+    VerseRender_Verse(Black, VerseText, BookName[0] != '\0');
+}
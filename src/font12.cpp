@@ -36,6 +36,7 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
 #include "fonts.h"
 
 // 
@@ -1379,6 +1380,10 @@ sFONT Font12 = {
   Font12_Table,
   7, /* Width */
   12, /* Height */
+  NULL, /* Spans: bitmap table */
+  NULL,
+  0,
+  0,
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -1,2142 +1,1456 @@
-/**
-  ******************************************************************************
-  * @file    font20.c
-  * @author  MCD Application Team
-  * @version V1.0.0
-  * @date    18-February-2014
-  * @brief   This file provides text font20 for STM32xx-EVAL's LCD driver. 
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
-  *
-  * Redistribution and use in source and binary forms, with or without modification,
-  * are permitted provided that the following conditions are met:
-  *   1. Redistributions of source code must retain the above copyright notice,
-  *      this list of conditions and the following disclaimer.
-  *   2. Redistributions in binary form must reproduce the above copyright notice,
-  *      this list of conditions and the following disclaimer in the documentation
-  *      and/or other materials provided with the distribution.
-  *   3. Neither the name of STMicroelectronics nor the names of its contributors
-  *      may be used to endorse or promote products derived from this software
-  *      without specific prior written permission.
-  *
-  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-  *
-  ******************************************************************************
-  */
-
-/* Includes ------------------------------------------------------------------*/
-#include "fonts.h"
-
-// Character bitmaps for Courier New 15pt
-const uint8_t Font20_Table[] = 
-{
-	// @0 ' ' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @40 '!' (14 pixels wide)
-	0x00, 0x00, //               
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x02, 0x00, //       #       
-	0x02, 0x00, //       #       
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @80 '"' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1C, 0xE0, //    ###  ###   
-	0x1C, 0xE0, //    ###  ###   
-	0x1C, 0xE0, //    ###  ###   
-	0x08, 0x40, //     #    #    
-	0x08, 0x40, //     #    #    
-	0x08, 0x40, //     #    #    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @120 '#' (14 pixels wide)
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @160 '$' (14 pixels wide)
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x07, 0xE0, //      ######   
-	0x0F, 0xE0, //     #######   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x00, //    ##         
-	0x1F, 0x00, //    #####      
-	0x0F, 0xC0, //     ######    
-	0x00, 0xE0, //         ###   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xC0, //    #######    
-	0x1F, 0x80, //    ######     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @200 '%' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1C, 0x00, //    ###        
-	0x22, 0x00, //   #   #       
-	0x22, 0x00, //   #   #       
-	0x22, 0x00, //   #   #       
-	0x1C, 0x60, //    ###   ##   
-	0x01, 0xE0, //        ####   
-	0x0F, 0x80, //     #####     
-	0x3C, 0x00, //   ####        
-	0x31, 0xC0, //   ##   ###    
-	0x02, 0x20, //       #   #   
-	0x02, 0x20, //       #   #   
-	0x02, 0x20, //       #   #   
-	0x01, 0xC0, //        ###    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @240 '&' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0xE0, //       #####   
-	0x0F, 0xE0, //     #######   
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x06, 0x00, //      ##       
-	0x0F, 0x30, //     ####  ##  
-	0x1F, 0xF0, //    #########  
-	0x19, 0xE0, //    ##  ####   
-	0x18, 0xC0, //    ##   ##    
-	0x1F, 0xF0, //    #########  
-	0x07, 0xB0, //      #### ##  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @280 ''' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x01, 0x00, //        #      
-	0x01, 0x00, //        #      
-	0x01, 0x00, //        #      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @320 '(' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @360 ')' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @400 '*' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1B, 0x60, //    ## ## ##   
-	0x1F, 0xE0, //    ########   
-	0x07, 0x80, //      ####     
-	0x07, 0x80, //      ####     
-	0x0F, 0xC0, //     ######    
-	0x0C, 0xC0, //     ##  ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @440 '+' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @480 ',' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x04, 0x00, //      #        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @520 '-' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @560 '.' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @600 '/' (14 pixels wide)
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @640 '0' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x1F, 0xC0, //    #######    
-	0x0F, 0x80, //     #####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @680 '1' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x1F, 0x00, //    #####      
-	0x1F, 0x00, //    #####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @720 '2' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x00, 0x60, //          ##   
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x18, 0x00, //    ##         
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @760 '3' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x3F, 0xC0, //   ########    
-	0x30, 0xE0, //   ##    ###   
-	0x00, 0x60, //          ##   
-	0x00, 0xE0, //         ###   
-	0x07, 0xC0, //      #####    
-	0x07, 0xC0, //      #####    
-	0x00, 0xE0, //         ###   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x60, 0xE0, //  ##     ###   
-	0x7F, 0xC0, //  #########    
-	0x3F, 0x80, //   #######     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @800 '4' (14 pixels wide)
-	0x00, 0x00, //               
-	0x01, 0xC0, //        ###    
-	0x03, 0xC0, //       ####    
-	0x03, 0xC0, //       ####    
-	0x06, 0xC0, //      ## ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0xC0, //   ##    ##    
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x00, 0xC0, //         ##    
-	0x03, 0xE0, //       #####   
-	0x03, 0xE0, //       #####   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @840 '5' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xC0, //    #######    
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x1F, 0x80, //    ######     
-	0x1F, 0xC0, //    #######    
-	0x18, 0xE0, //    ##   ###   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x30, 0xE0, //   ##    ###   
-	0x3F, 0xC0, //   ########    
-	0x1F, 0x80, //    ######     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @880 '6' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0xE0, //       #####   
-	0x0F, 0xE0, //     #######   
-	0x1E, 0x00, //    ####       
-	0x18, 0x00, //    ##         
-	0x38, 0x00, //   ###         
-	0x37, 0x80, //   ## ####     
-	0x3F, 0xC0, //   ########    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xE0, //    ##   ###   
-	0x1F, 0xC0, //    #######    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @920 '7' (14 pixels wide)
-	0x00, 0x00, //               
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x30, 0x60, //   ##     ##   
-	0x00, 0x60, //          ##   
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @960 '8' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x38, 0xE0, //   ###   ###   
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xC0, //    #######    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x38, 0xE0, //   ###   ###   
-	0x1F, 0xC0, //    #######    
-	0x0F, 0x80, //     #####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1000 '9' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x00, //     ####      
-	0x1F, 0xC0, //    #######    
-	0x38, 0xC0, //   ###   ##    
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x38, 0xE0, //   ###   ###   
-	0x1F, 0xE0, //    ########   
-	0x0F, 0x60, //     #### ##   
-	0x00, 0xE0, //         ###   
-	0x00, 0xC0, //         ##    
-	0x03, 0xC0, //       ####    
-	0x3F, 0x80, //   #######     
-	0x3E, 0x00, //   #####       
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1040 ':' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1080 ';' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x01, 0xC0, //        ###    
-	0x01, 0xC0, //        ###    
-	0x01, 0xC0, //        ###    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x04, 0x00, //      #        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1120 '<' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x30, //           ##  
-	0x00, 0xF0, //         ####  
-	0x03, 0xC0, //       ####    
-	0x07, 0x00, //      ###      
-	0x1C, 0x00, //    ###        
-	0x78, 0x00, //  ####         
-	0x1C, 0x00, //    ###        
-	0x07, 0x00, //      ###      
-	0x03, 0xC0, //       ####    
-	0x00, 0xF0, //         ####  
-	0x00, 0x30, //           ##  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1160 '=' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7F, 0xF0, //  ###########  
-	0x7F, 0xF0, //  ###########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7F, 0xF0, //  ###########  
-	0x7F, 0xF0, //  ###########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1200 '>' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x30, 0x00, //   ##          
-	0x3C, 0x00, //   ####        
-	0x0F, 0x00, //     ####      
-	0x03, 0x80, //       ###     
-	0x00, 0xE0, //         ###   
-	0x00, 0x78, //          #### 
-	0x00, 0xE0, //         ###   
-	0x03, 0x80, //       ###     
-	0x0F, 0x00, //     ####      
-	0x3C, 0x00, //   ####        
-	0x30, 0x00, //   ##          
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1240 '?' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x00, 0x60, //          ##   
-	0x01, 0xC0, //        ###    
-	0x03, 0x80, //       ###     
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1280 '@' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x0C, 0x80, //     ##  #     
-	0x08, 0x40, //     #    #    
-	0x10, 0x40, //    #     #    
-	0x10, 0x40, //    #     #    
-	0x11, 0xC0, //    #   ###    
-	0x12, 0x40, //    #  #  #    
-	0x12, 0x40, //    #  #  #    
-	0x12, 0x40, //    #  #  #    
-	0x11, 0xC0, //    #   ###    
-	0x10, 0x00, //    #          
-	0x08, 0x00, //     #         
-	0x08, 0x40, //     #    #    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1320 'A' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0x80, //    ######     
-	0x1F, 0x80, //    ######     
-	0x03, 0x80, //       ###     
-	0x06, 0xC0, //      ## ##    
-	0x06, 0xC0, //      ## ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0x60, //     ##   ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x30, 0x30, //   ##      ##  
-	0x78, 0x78, //  ####    #### 
-	0x78, 0x78, //  ####    #### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1360 'B' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0x80, //   #######     
-	0x3F, 0xC0, //   ########    
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0xE0, //    ##   ###   
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xE0, //    ########   
-	0x18, 0x70, //    ##    ###  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xE0, //   #########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1400 'C' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB0, //      #### ##  
-	0x0F, 0xF0, //     ########  
-	0x1C, 0x70, //    ###   ###  
-	0x38, 0x30, //   ###     ##  
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x38, 0x30, //   ###     ##  
-	0x1C, 0x70, //    ###   ###  
-	0x0F, 0xE0, //     #######   
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1440 'D' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7F, 0x80, //  ########     
-	0x7F, 0xC0, //  #########    
-	0x30, 0xE0, //   ##    ###   
-	0x30, 0x70, //   ##     ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x70, //   ##     ###  
-	0x30, 0xE0, //   ##    ###   
-	0x7F, 0xC0, //  #########    
-	0x7F, 0x80, //  ########     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1480 'E' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x19, 0x80, //    ##  ##     
-	0x1F, 0x80, //    ######     
-	0x1F, 0x80, //    ######     
-	0x19, 0x80, //    ##  ##     
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1520 'F' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x19, 0x80, //    ##  ##     
-	0x1F, 0x80, //    ######     
-	0x1F, 0x80, //    ######     
-	0x19, 0x80, //    ##  ##     
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x3F, 0x00, //   ######      
-	0x3F, 0x00, //   ######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1560 'G' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB0, //      #### ##  
-	0x1F, 0xF0, //    #########  
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x31, 0xF8, //   ##   ###### 
-	0x31, 0xF8, //   ##   ###### 
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x30, //    ##     ##  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1600 'H' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1640 'I' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1680 'J' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0xF8, //       ####### 
-	0x03, 0xF8, //       ####### 
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0xE0, //   ##    ###   
-	0x3F, 0xC0, //   ########    
-	0x0F, 0x80, //     #####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1720 'K' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3E, 0xF8, //   ##### ##### 
-	0x3E, 0xF8, //   ##### ##### 
-	0x18, 0xE0, //    ##   ###   
-	0x19, 0x80, //    ##  ##     
-	0x1B, 0x00, //    ## ##      
-	0x1F, 0x00, //    #####      
-	0x1D, 0x80, //    ### ##     
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0x60, //    ##    ##   
-	0x3E, 0x78, //   #####  #### 
-	0x3E, 0x38, //   #####   ### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1760 'L' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0x00, //   ######      
-	0x3F, 0x00, //   ######      
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x30, //     ##    ##  
-	0x0C, 0x30, //     ##    ##  
-	0x0C, 0x30, //     ##    ##  
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1800 'M' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0x78, //  ####    #### 
-	0x78, 0x78, //  ####    #### 
-	0x38, 0x70, //   ###    ###  
-	0x3C, 0xF0, //   ####  ####  
-	0x34, 0xB0, //   ## #  # ##  
-	0x37, 0xB0, //   ## #### ##  
-	0x37, 0xB0, //   ## #### ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x30, 0x30, //   ##      ##  
-	0x7C, 0xF8, //  #####  ##### 
-	0x7C, 0xF8, //  #####  ##### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1840 'N' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x39, 0xF0, //   ###  #####  
-	0x3D, 0xF0, //   #### #####  
-	0x1C, 0x60, //    ###   ##   
-	0x1E, 0x60, //    ####  ##   
-	0x1E, 0x60, //    ####  ##   
-	0x1B, 0x60, //    ## ## ##   
-	0x1B, 0x60, //    ## ## ##   
-	0x19, 0xE0, //    ##  ####   
-	0x19, 0xE0, //    ##  ####   
-	0x18, 0xE0, //    ##   ###   
-	0x3E, 0xE0, //   ##### ###   
-	0x3E, 0x60, //   #####  ##   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1880 'O' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x0F, 0xC0, //     ######    
-	0x1C, 0xE0, //    ###  ###   
-	0x38, 0x70, //   ###    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x1C, 0xE0, //    ###  ###   
-	0x0F, 0xC0, //     ######    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1920 'P' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xC0, //   ########    
-	0x3F, 0xE0, //   #########   
-	0x18, 0x70, //    ##    ###  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xC0, //    #######    
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x3F, 0x00, //   ######      
-	0x3F, 0x00, //   ######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1960 'Q' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x0F, 0xC0, //     ######    
-	0x1C, 0xE0, //    ###  ###   
-	0x38, 0x70, //   ###    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x1C, 0xE0, //    ###  ###   
-	0x0F, 0xC0, //     ######    
-	0x07, 0x80, //      ####     
-	0x07, 0xB0, //      #### ##  
-	0x0F, 0xF0, //     ########  
-	0x0C, 0xE0, //     ##  ###   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2000 'R' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xC0, //   ########    
-	0x3F, 0xE0, //   #########   
-	0x18, 0x70, //    ##    ###  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xC0, //    #######    
-	0x18, 0xE0, //    ##   ###   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x70, //    ##    ###  
-	0x3E, 0x38, //   #####   ### 
-	0x3E, 0x18, //   #####    ## 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2040 'S' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0F, 0xB0, //     ##### ##  
-	0x1F, 0xF0, //    #########  
-	0x38, 0x70, //   ###    ###  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x00, //   ###         
-	0x1F, 0x80, //    ######     
-	0x07, 0xE0, //      ######   
-	0x00, 0x70, //          ###  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x3F, 0xE0, //   #########   
-	0x37, 0xC0, //   ## #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2080 'T' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x0F, 0xC0, //     ######    
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2120 'U' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x1C, 0xE0, //    ###  ###   
-	0x0F, 0xC0, //     ######    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2160 'V' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x0D, 0x80, //     ## ##     
-	0x0D, 0x80, //     ## ##     
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2200 'W' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7C, 0x7C, //  #####   #####
-	0x7C, 0x7C, //  #####   #####
-	0x30, 0x18, //   ##       ## 
-	0x33, 0x98, //   ##  ###  ## 
-	0x33, 0x98, //   ##  ###  ## 
-	0x33, 0x98, //   ##  ###  ## 
-	0x36, 0xD8, //   ## ## ## ## 
-	0x16, 0xD0, //    # ## ## #  
-	0x1C, 0x70, //    ###   ###  
-	0x1C, 0x70, //    ###   ###  
-	0x1C, 0x70, //    ###   ###  
-	0x18, 0x30, //    ##     ##  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2240 'X' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x0D, 0x80, //     ## ##     
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0x60, //   ##     ##   
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2280 'Y' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x18, 0x60, //    ##    ##   
-	0x0C, 0xC0, //     ##  ##    
-	0x07, 0x80, //      ####     
-	0x07, 0x80, //      ####     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x0F, 0xC0, //     ######    
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2320 'Z' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0xC0, //    ##   ##    
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x0C, 0x60, //     ##   ##   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2360 '[' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0xC0, //       ####    
-	0x03, 0xC0, //       ####    
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0xC0, //       ####    
-	0x03, 0xC0, //       ####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2400 '\' (14 pixels wide)
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2440 ']' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x00, //     ####      
-	0x0F, 0x00, //     ####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x0F, 0x00, //     ####      
-	0x0F, 0x00, //     ####      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2480 '^' (14 pixels wide)
-	0x00, 0x00, //               
-	0x02, 0x00, //       #       
-	0x07, 0x00, //      ###      
-	0x0D, 0x80, //     ## ##     
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0x60, //   ##     ##   
-	0x20, 0x20, //   #       #   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2520 '_' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0xFF, 0xFC, // ##############
-	0xFF, 0xFC, // ##############
-
-	// @2560 '`' (14 pixels wide)
-	0x00, 0x00, //               
-	0x04, 0x00, //      #        
-	0x03, 0x00, //       ##      
-	0x00, 0x80, //         #     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2600 'a' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0F, 0xC0, //     ######    
-	0x1F, 0xE0, //    ########   
-	0x00, 0x60, //          ##   
-	0x0F, 0xE0, //     #######   
-	0x1F, 0xE0, //    ########   
-	0x38, 0x60, //   ###    ##   
-	0x30, 0xE0, //   ##    ###   
-	0x3F, 0xF0, //   ##########  
-	0x1F, 0x70, //    ##### ###  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2640 'b' (14 pixels wide)
-	0x00, 0x00, //               
-	0x70, 0x00, //  ###          
-	0x70, 0x00, //  ###          
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x37, 0x80, //   ## ####     
-	0x3F, 0xE0, //   #########   
-	0x38, 0x60, //   ###    ##   
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x60, //   ###    ##   
-	0x7F, 0xE0, //  ##########   
-	0x77, 0x80, //  ### ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2680 'c' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB0, //      #### ##  
-	0x1F, 0xF0, //    #########  
-	0x18, 0x30, //    ##     ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x38, 0x30, //   ###     ##  
-	0x1F, 0xF0, //    #########  
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2720 'd' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x70, //          ###  
-	0x00, 0x70, //          ###  
-	0x00, 0x30, //           ##  
-	0x00, 0x30, //           ##  
-	0x07, 0xB0, //      #### ##  
-	0x1F, 0xF0, //    #########  
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x1F, 0xF8, //    ########## 
-	0x07, 0xB8, //      #### ### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2760 'e' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x30, 0x00, //   ##          
-	0x18, 0x30, //    ##     ##  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2800 'f' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0xF0, //       ######  
-	0x07, 0xF0, //      #######  
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2840 'g' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB8, //      #### ### 
-	0x1F, 0xF8, //    ########## 
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xB0, //      #### ##  
-	0x00, 0x30, //           ##  
-	0x00, 0x70, //          ###  
-	0x0F, 0xE0, //     #######   
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2880 'h' (14 pixels wide)
-	0x00, 0x00, //               
-	0x38, 0x00, //   ###         
-	0x38, 0x00, //   ###         
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x1B, 0xC0, //    ## ####    
-	0x1F, 0xE0, //    ########   
-	0x1C, 0x60, //    ###   ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2920 'i' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0x00, //    #####      
-	0x1F, 0x00, //    #####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2960 'j' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xC0, //    #######    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0xC0, //        ###    
-	0x3F, 0x80, //   #######     
-	0x3F, 0x00, //   ######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3000 'k' (14 pixels wide)
-	0x00, 0x00, //               
-	0x38, 0x00, //   ###         
-	0x38, 0x00, //   ###         
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x1B, 0xE0, //    ## #####   
-	0x1B, 0xE0, //    ## #####   
-	0x1B, 0x00, //    ## ##      
-	0x1E, 0x00, //    ####       
-	0x1E, 0x00, //    ####       
-	0x1B, 0x00, //    ## ##      
-	0x19, 0x80, //    ##  ##     
-	0x39, 0xF0, //   ###  #####  
-	0x39, 0xF0, //   ###  #####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3040 'l' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1F, 0x00, //    #####      
-	0x1F, 0x00, //    #####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3080 'm' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7E, 0xE0, //  ###### ###   
-	0x7F, 0xF0, //  ###########  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x7B, 0xB8, //  #### ### ### 
-	0x7B, 0xB8, //  #### ### ### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3120 'n' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3B, 0xC0, //   ### ####    
-	0x3F, 0xE0, //   #########   
-	0x1C, 0x60, //    ###   ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3160 'o' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3200 'p' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x77, 0x80, //  ### ####     
-	0x7F, 0xE0, //  ##########   
-	0x38, 0x60, //   ###    ##   
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x60, //   ###    ##   
-	0x3F, 0xE0, //   #########   
-	0x37, 0x80, //   ## ####     
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x7C, 0x00, //  #####        
-	0x7C, 0x00, //  #####        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3240 'q' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB8, //      #### ### 
-	0x1F, 0xF8, //    ########## 
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xB0, //      #### ##  
-	0x00, 0x30, //           ##  
-	0x00, 0x30, //           ##  
-	0x00, 0xF8, //         ##### 
-	0x00, 0xF8, //         ##### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3280 'r' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xE0, //   ####  ###   
-	0x3D, 0xF0, //   #### #####  
-	0x0F, 0x30, //     ####  ##  
-	0x0E, 0x00, //     ###       
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x3F, 0xC0, //   ########    
-	0x3F, 0xC0, //   ########    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3320 's' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xE0, //      ######   
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x1E, 0x00, //    ####       
-	0x0F, 0xC0, //     ######    
-	0x01, 0xE0, //        ####   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0x80, //    ######     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3360 't' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x30, //     ##    ##  
-	0x0F, 0xF0, //     ########  
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3400 'u' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x38, 0xE0, //   ###   ###   
-	0x38, 0xE0, //   ###   ###   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0xE0, //    ##   ###   
-	0x1F, 0xF0, //    #########  
-	0x0F, 0x70, //     #### ###  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3440 'v' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x0D, 0x80, //     ## ##     
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3480 'w' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x32, 0x60, //   ##  #  ##   
-	0x32, 0x60, //   ##  #  ##   
-	0x37, 0xE0, //   ## ######   
-	0x1D, 0xC0, //    ### ###    
-	0x1D, 0xC0, //    ### ###    
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3520 'x' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x0C, 0xC0, //     ##  ##    
-	0x07, 0x80, //      ####     
-	0x03, 0x00, //       ##      
-	0x07, 0x80, //      ####     
-	0x0C, 0xC0, //     ##  ##    
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3560 'y' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x0F, 0x80, //     #####     
-	0x07, 0x00, //      ###      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x7F, 0x00, //  #######      
-	0x7F, 0x00, //  #######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3600 'z' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x18, 0xC0, //    ##   ##    
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x0C, 0x60, //     ##   ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3640 '{' (14 pixels wide)
-	0x00, 0x00, //               
-	0x01, 0xC0, //        ###    
-	0x03, 0xC0, //       ####    
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x07, 0x00, //      ###      
-	0x0E, 0x00, //     ###       
-	0x07, 0x00, //      ###      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0xC0, //       ####    
-	0x01, 0xC0, //        ###    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3680 '|' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3720 '}' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1C, 0x00, //    ###        
-	0x1E, 0x00, //    ####       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x07, 0x00, //      ###      
-	0x03, 0x80, //       ###     
-	0x07, 0x00, //      ###      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x1E, 0x00, //    ####       
-	0x1C, 0x00, //    ###        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3760 '~' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0E, 0x00, //     ###       
-	0x3F, 0x30, //   ######  ##  
-	0x33, 0xF0, //   ##  ######  
-	0x01, 0xE0, //        ####   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-};
-
-
-sFONT Font20 = {
-  Font20_Table,
-  14, /* Width */
-  20, /* Height */
-};
-
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+/**
+ * Font20 (14x20) as column spans, see tools/fontc/fontc.py
+ * Compiled from fonts/font20.cpp, do not edit.
+ */
+#include <stddef.h>
+#include "fonts.h"
+
+// 2983 bytes (bitmap table: 3800)
+const uint8_t Font20_Spans[] = {
+    // @0 ' '
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @14 '!'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x17, 0x42, 0x00, /* |.#######....##......| */
+    0x19, 0x22, 0x00, /* |.#########..##......| */
+    0x17, 0x42, 0x00, /* |.#######....##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @34 '"'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x23, 0x00, /* |..###...............| */
+    0x26, 0x00, /* |..######............| */
+    0x23, 0x00, /* |..###...............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x23, 0x00, /* |..###...............| */
+    0x26, 0x00, /* |..######............| */
+    0x23, 0x00, /* |..###...............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @54 '#'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0xF0, 0x00, 0x10, 0x00, /* |################....| */
+    0xF0, 0x00, 0x10, 0x00, /* |################....| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0xF0, 0x00, 0x10, 0x00, /* |################....| */
+    0xF0, 0x00, 0x10, 0x00, /* |################....| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @92 '$'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x43, 0x24, 0x00, /* |....###..####.......| */
+    0x35, 0x14, 0x00, /* |...#####.####.......| */
+    0x22, 0x22, 0x32, 0x00, /* |..##..##...##.......| */
+    0x04, 0x22, 0x35, 0x00, /* |####..##...#####....| */
+    0x04, 0x22, 0x35, 0x00, /* |####..##...#####....| */
+    0x22, 0x32, 0x22, 0x00, /* |..##...##..##.......| */
+    0x23, 0x25, 0x00, /* |..###..#####........| */
+    0x23, 0x33, 0x00, /* |..###...###.........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @126 '%'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x23, 0x32, 0x00, /* |..###...##..........| */
+    0x11, 0x31, 0x22, 0x00, /* |.#...#..##..........| */
+    0x11, 0x31, 0x12, 0x00, /* |.#...#.##...........| */
+    0x11, 0x31, 0x12, 0x00, /* |.#...#.##...........| */
+    0x23, 0x21, 0x23, 0x00, /* |..###..#..###.......| */
+    0x62, 0x11, 0x31, 0x00, /* |......##.#...#......| */
+    0x62, 0x11, 0x31, 0x00, /* |......##.#...#......| */
+    0x52, 0x21, 0x31, 0x00, /* |.....##..#...#......| */
+    0x52, 0x33, 0x00, /* |.....##...###.......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @165 '&'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x94, 0x00, /* |.........####.......| */
+    0x43, 0x15, 0x00, /* |....###.#####.......| */
+    0x46, 0x22, 0x00, /* |....######..##......| */
+    0x32, 0x23, 0x22, 0x00, /* |...##..###..##......| */
+    0x32, 0x33, 0x12, 0x00, /* |...##...###.##......| */
+    0x32, 0x45, 0x00, /* |...##....#####......| */
+    0x32, 0x44, 0x00, /* |...##....####.......| */
+    0x32, 0x33, 0x12, 0x00, /* |...##...###.##......| */
+    0x82, 0x22, 0x00, /* |........##..##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @199 "'"
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x23, 0x00, /* |..###...............| */
+    0x26, 0x00, /* |..######............| */
+    0x23, 0x00, /* |..###...............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @216 '('
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x66, 0x00, /* |......######........| */
+    0x3C, 0x00, /* |...############.....| */
+    0x15, 0x65, 0x00, /* |.#####......#####...| */
+    0x12, 0xC2, 0x00, /* |.##............##...| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @236 ')'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x12, 0xC2, 0x00, /* |.##............##...| */
+    0x15, 0x65, 0x00, /* |.#####......#####...| */
+    0x3C, 0x00, /* |...############.....| */
+    0x66, 0x00, /* |......######........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @256 '*'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x42, 0x00, /* |....##..............| */
+    0x42, 0x22, 0x00, /* |....##..##..........| */
+    0x55, 0x00, /* |.....#####..........| */
+    0x18, 0x00, /* |.########...........| */
+    0x18, 0x00, /* |.########...........| */
+    0x55, 0x00, /* |.....#####..........| */
+    0x42, 0x22, 0x00, /* |....##..##..........| */
+    0x42, 0x00, /* |....##..............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @280 '+'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x3A, 0x00, /* |...##########.......| */
+    0x3A, 0x00, /* |...##########.......| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @304 ','
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0xE3, 0x00, /* |..............###...| */
+    0xB5, 0x00, /* |...........#####....| */
+    0xB3, 0x00, /* |...........###......| */
+    0xB1, 0x00, /* |...........#........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @322 '-'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @345 '.'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0xB3, 0x00, /* |...........###......| */
+    0xB3, 0x00, /* |...........###......| */
+    0xB3, 0x00, /* |...........###......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @362 '/'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0xE2, 0x00, /* |..............##....| */
+    0xB5, 0x00, /* |...........#####....| */
+    0x95, 0x00, /* |.........#####......| */
+    0x74, 0x00, /* |.......####.........| */
+    0x54, 0x00, /* |.....####...........| */
+    0x25, 0x00, /* |..#####.............| */
+    0x05, 0x00, /* |#####...............| */
+    0x02, 0x00, /* |##..................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @384 '0'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x47, 0x00, /* |....#######.........| */
+    0x2B, 0x00, /* |..###########.......| */
+    0x13, 0x73, 0x00, /* |.###.......###......| */
+    0x12, 0x92, 0x00, /* |.##.........##......| */
+    0x12, 0x92, 0x00, /* |.##.........##......| */
+    0x12, 0x92, 0x00, /* |.##.........##......| */
+    0x13, 0x73, 0x00, /* |.###.......###......| */
+    0x2B, 0x00, /* |..###########.......| */
+    0x47, 0x00, /* |....#######.........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @412 '1'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x1D, 0x00, /* |.#############......| */
+    0x1D, 0x00, /* |.#############......| */
+    0xC2, 0x00, /* |............##......| */
+    0xC2, 0x00, /* |............##......| */
+    0xC2, 0x00, /* |............##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @437 '2'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x32, 0x72, 0x00, /* |...##.......##......| */
+    0x23, 0x63, 0x00, /* |..###......###......| */
+    0x13, 0x64, 0x00, /* |.###......####......| */
+    0x12, 0x62, 0x12, 0x00, /* |.##......##.##......| */
+    0x12, 0x52, 0x22, 0x00, /* |.##.....##..##......| */
+    0x12, 0x42, 0x32, 0x00, /* |.##....##...##......| */
+    0x13, 0x22, 0x42, 0x00, /* |.###..##....##......| */
+    0x25, 0x52, 0x00, /* |..#####.....##......| */
+    0x33, 0x62, 0x00, /* |...###......##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @473 '3'
+    0x00, /* |....................| */
+    0xB2, 0x00, /* |...........##.......| */
+    0x22, 0x73, 0x00, /* |..##.......###......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x12, 0x92, 0x00, /* |.##.........##......| */
+    0x12, 0x32, 0x42, 0x00, /* |.##...##....##......| */
+    0x12, 0x32, 0x42, 0x00, /* |.##...##....##......| */
+    0x12, 0x32, 0x42, 0x00, /* |.##...##....##......| */
+    0x13, 0x14, 0x23, 0x00, /* |.###.####..###......| */
+    0x2B, 0x00, /* |..###########.......| */
+    0x33, 0x24, 0x00, /* |...###..####........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @509 '4'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x83, 0x00, /* |........###.........| */
+    0x74, 0x00, /* |.......####.........| */
+    0x53, 0x12, 0x00, /* |.....###.##.........| */
+    0x43, 0x22, 0x00, /* |....###..##.........| */
+    0x23, 0x42, 0x12, 0x00, /* |..###....##.##......| */
+    0x13, 0x52, 0x12, 0x00, /* |.###.....##.##......| */
+    0x1D, 0x00, /* |.#############......| */
+    0x1D, 0x00, /* |.#############......| */
+    0x92, 0x12, 0x00, /* |.........##.##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @539 '5'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0xB2, 0x00, /* |...........##.......| */
+    0x17, 0x33, 0x00, /* |.#######...###......| */
+    0x17, 0x42, 0x00, /* |.#######....##......| */
+    0x12, 0x22, 0x52, 0x00, /* |.##..##.....##......| */
+    0x12, 0x22, 0x52, 0x00, /* |.##..##.....##......| */
+    0x12, 0x22, 0x52, 0x00, /* |.##..##.....##......| */
+    0x12, 0x23, 0x33, 0x00, /* |.##..###...###......| */
+    0x12, 0x37, 0x00, /* |.##...#######.......| */
+    0x75, 0x00, /* |.......#####........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @573 '6'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x56, 0x00, /* |.....######.........| */
+    0x3A, 0x00, /* |...##########.......| */
+    0x24, 0x12, 0x22, 0x00, /* |..####.##..##.......| */
+    0x22, 0x22, 0x42, 0x00, /* |..##..##....##......| */
+    0x13, 0x22, 0x42, 0x00, /* |.###..##....##......| */
+    0x12, 0x32, 0x42, 0x00, /* |.##...##....##......| */
+    0x12, 0x33, 0x23, 0x00, /* |.##...###..###......| */
+    0x12, 0x46, 0x00, /* |.##....######.......| */
+    0x12, 0x54, 0x00, /* |.##.....####........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @608 '7'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x13, 0x00, /* |.###................| */
+    0x13, 0x00, /* |.###................| */
+    0x12, 0x00, /* |.##.................| */
+    0x12, 0x00, /* |.##.................| */
+    0x12, 0x83, 0x00, /* |.##........###......| */
+    0x12, 0x56, 0x00, /* |.##.....######......| */
+    0x12, 0x26, 0x00, /* |.##..######.........| */
+    0x17, 0x00, /* |.#######............| */
+    0x14, 0x00, /* |.####...............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @634 '8'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x33, 0x24, 0x00, /* |...###..####........| */
+    0x2B, 0x00, /* |..###########.......| */
+    0x13, 0x14, 0x23, 0x00, /* |.###.####..###......| */
+    0x12, 0x32, 0x42, 0x00, /* |.##...##....##......| */
+    0x12, 0x32, 0x42, 0x00, /* |.##...##....##......| */
+    0x12, 0x32, 0x42, 0x00, /* |.##...##....##......| */
+    0x13, 0x14, 0x23, 0x00, /* |.###.####..###......| */
+    0x2B, 0x00, /* |..###########.......| */
+    0x33, 0x24, 0x00, /* |...###..####........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @669 '9'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x34, 0x52, 0x00, /* |...####.....##......| */
+    0x26, 0x42, 0x00, /* |..######....##......| */
+    0x13, 0x23, 0x32, 0x00, /* |.###..###...##......| */
+    0x12, 0x42, 0x32, 0x00, /* |.##....##...##......| */
+    0x12, 0x42, 0x23, 0x00, /* |.##....##..###......| */
+    0x12, 0x42, 0x22, 0x00, /* |.##....##..##.......| */
+    0x22, 0x22, 0x14, 0x00, /* |..##..##.####.......| */
+    0x2A, 0x00, /* |..##########........| */
+    0x46, 0x00, /* |....######..........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @704 ':'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x53, 0x33, 0x00, /* |.....###...###......| */
+    0x53, 0x33, 0x00, /* |.....###...###......| */
+    0x53, 0x33, 0x00, /* |.....###...###......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @724 ';'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0xD3, 0x00, /* |.............###....| */
+    0xB4, 0x00, /* |...........####.....| */
+    0x53, 0x32, 0x00, /* |.....###...##.......| */
+    0x53, 0x31, 0x00, /* |.....###...#........| */
+    0x53, 0x00, /* |.....###............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @745 '<'
+    0x00, /* |....................| */
+    0x81, 0x00, /* |........#...........| */
+    0x81, 0x00, /* |........#...........| */
+    0x73, 0x00, /* |.......###..........| */
+    0x73, 0x00, /* |.......###..........| */
+    0x62, 0x12, 0x00, /* |......##.##.........| */
+    0x52, 0x32, 0x00, /* |.....##...##........| */
+    0x52, 0x32, 0x00, /* |.....##...##........| */
+    0x42, 0x52, 0x00, /* |....##.....##.......| */
+    0x42, 0x52, 0x00, /* |....##.....##.......| */
+    0x32, 0x72, 0x00, /* |...##.......##......| */
+    0x32, 0x72, 0x00, /* |...##.......##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @777 '='
+    0x00, /* |....................| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x52, 0x22, 0x00, /* |.....##..##.........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @813 '>'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x32, 0x72, 0x00, /* |...##.......##......| */
+    0x32, 0x72, 0x00, /* |...##.......##......| */
+    0x42, 0x52, 0x00, /* |....##.....##.......| */
+    0x42, 0x52, 0x00, /* |....##.....##.......| */
+    0x52, 0x32, 0x00, /* |.....##...##........| */
+    0x52, 0x32, 0x00, /* |.....##...##........| */
+    0x62, 0x12, 0x00, /* |......##.##.........| */
+    0x73, 0x00, /* |.......###..........| */
+    0x73, 0x00, /* |.......###..........| */
+    0x81, 0x00, /* |........#...........| */
+    0x81, 0x00, /* |........#...........| */
+    0x00, /* |....................| */
+    // @845 '?'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x33, 0x00, /* |...###..............| */
+    0x24, 0x00, /* |..####..............| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x42, 0x22, 0x00, /* |..##....##..##......| */
+    0x22, 0x33, 0x22, 0x00, /* |..##...###..##......| */
+    0x22, 0x32, 0x00, /* |..##...##...........| */
+    0x35, 0x00, /* |...#####............| */
+    0x43, 0x00, /* |....###.............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @873 '@'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x48, 0x00, /* |....########........| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x21, 0xB1, 0x00, /* |..#...........#.....| */
+    0x11, 0x53, 0x41, 0x00, /* |.#.....###....#.....| */
+    0x11, 0x41, 0x31, 0x31, 0x00, /* |.#....#...#...#.....| */
+    0x12, 0x31, 0x31, 0x31, 0x00, /* |.##...#...#...#.....| */
+    0x38, 0x21, 0x00, /* |...########..#......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @905 'A'
+    0x00, /* |....................| */
+    0xC2, 0x00, /* |............##......| */
+    0xB3, 0x00, /* |...........###......| */
+    0x22, 0x55, 0x00, /* |..##.....#####......| */
+    0x22, 0x34, 0x12, 0x00, /* |..##...####.##......| */
+    0x22, 0x16, 0x00, /* |..##.######.........| */
+    0x25, 0x22, 0x00, /* |..#####..##.........| */
+    0x23, 0x42, 0x00, /* |..###....##.........| */
+    0x26, 0x12, 0x00, /* |..######.##.........| */
+    0x56, 0x12, 0x00, /* |.....######.##......| */
+    0x86, 0x00, /* |........######......| */
+    0xB3, 0x00, /* |...........###......| */
+    0xC2, 0x00, /* |............##......| */
+    0x00, /* |....................| */
+    // @939 'B'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x23, 0x32, 0x00, /* |..##..###...##......| */
+    0x37, 0x22, 0x00, /* |...#######..##......| */
+    0x43, 0x16, 0x00, /* |....###.######......| */
+    0x94, 0x00, /* |.........####.......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @974 'C'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x56, 0x00, /* |.....######.........| */
+    0x48, 0x00, /* |....########........| */
+    0x33, 0x43, 0x00, /* |...###....###.......| */
+    0x23, 0x63, 0x00, /* |..###......###......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x32, 0x63, 0x00, /* |...##......###......| */
+    0x24, 0x43, 0x00, /* |..####....###.......| */
+    0x24, 0x42, 0x00, /* |..####....##........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1006 'D'
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x23, 0x63, 0x00, /* |..###......###......| */
+    0x33, 0x43, 0x00, /* |...###....###.......| */
+    0x48, 0x00, /* |....########........| */
+    0x56, 0x00, /* |.....######.........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1038 'E'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x24, 0x22, 0x00, /* |..##..####..##......| */
+    0x22, 0x24, 0x22, 0x00, /* |..##..####..##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x24, 0x44, 0x00, /* |..####....####......| */
+    0x24, 0x44, 0x00, /* |..####....####......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1074 'F'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x24, 0x22, 0x00, /* |..##..####..##......| */
+    0x22, 0x24, 0x00, /* |..##..####..........| */
+    0x22, 0x00, /* |..##................| */
+    0x24, 0x00, /* |..####..............| */
+    0x24, 0x00, /* |..####..............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1106 'G'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x56, 0x00, /* |.....######.........| */
+    0x3A, 0x00, /* |...##########.......| */
+    0x32, 0x62, 0x00, /* |...##......##.......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x42, 0x22, 0x00, /* |..##....##..##......| */
+    0x22, 0x42, 0x22, 0x00, /* |..##....##..##......| */
+    0x32, 0x32, 0x22, 0x00, /* |...##...##..##......| */
+    0x24, 0x25, 0x00, /* |..####..#####.......| */
+    0x24, 0x25, 0x00, /* |..####..#####.......| */
+    0x82, 0x00, /* |........##..........| */
+    0x00, /* |....................| */
+    // @1142 'H'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1172 'I'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1200 'J'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x85, 0x00, /* |........#####.......| */
+    0x85, 0x00, /* |........#####.......| */
+    0xC2, 0x00, /* |............##......| */
+    0xC2, 0x00, /* |............##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x73, 0x00, /* |..##.......###......| */
+    0x2B, 0x00, /* |..###########.......| */
+    0x2A, 0x00, /* |..##########........| */
+    0x22, 0x00, /* |..##................| */
+    0x22, 0x00, /* |..##................| */
+    0x00, /* |....................| */
+    // @1228 'K'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x22, 0x42, 0x00, /* |..##..##....##......| */
+    0x54, 0x00, /* |.....####...........| */
+    0x24, 0x23, 0x00, /* |..####..###.........| */
+    0x23, 0x44, 0x00, /* |..###....####.......| */
+    0x23, 0x63, 0x00, /* |..###......###......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x00, /* |....................| */
+    // @1263 'L'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0xC2, 0x00, /* |............##......| */
+    0xC2, 0x00, /* |............##......| */
+    0x95, 0x00, /* |.........#####......| */
+    0x95, 0x00, /* |.........#####......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1291 'M'
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x24, 0x62, 0x00, /* |..####......##......| */
+    0x54, 0x32, 0x00, /* |.....####...##......| */
+    0x74, 0x00, /* |.......####.........| */
+    0x74, 0x00, /* |.......####.........| */
+    0x54, 0x32, 0x00, /* |.....####...##......| */
+    0x24, 0x62, 0x00, /* |..####......##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x00, /* |....................| */
+    // @1323 'N'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x34, 0x52, 0x00, /* |...####.....##......| */
+    0x54, 0x32, 0x00, /* |.....####...##......| */
+    0x22, 0x34, 0x00, /* |..##...####.........| */
+    0x22, 0x54, 0x00, /* |..##.....####.......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x00, /* |..##................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1352 'O'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x56, 0x00, /* |.....######.........| */
+    0x48, 0x00, /* |....########........| */
+    0x33, 0x43, 0x00, /* |...###....###.......| */
+    0x23, 0x63, 0x00, /* |..###......###......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x23, 0x63, 0x00, /* |..###......###......| */
+    0x33, 0x43, 0x00, /* |...###....###.......| */
+    0x48, 0x00, /* |....########........| */
+    0x56, 0x00, /* |.....######.........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1382 'P'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x42, 0x22, 0x00, /* |..##....##..##......| */
+    0x22, 0x42, 0x22, 0x00, /* |..##....##..##......| */
+    0x22, 0x42, 0x22, 0x00, /* |..##....##..##......| */
+    0x22, 0x42, 0x00, /* |..##....##..........| */
+    0x23, 0x23, 0x00, /* |..###..###..........| */
+    0x36, 0x00, /* |...######...........| */
+    0x44, 0x00, /* |....####............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1415 'Q'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x56, 0x00, /* |.....######.........| */
+    0x48, 0x00, /* |....########........| */
+    0x33, 0x43, 0x22, 0x00, /* |...###....###..##...| */
+    0x23, 0x66, 0x00, /* |..###......######...| */
+    0x22, 0x84, 0x00, /* |..##........####....| */
+    0x22, 0x84, 0x00, /* |..##........####....| */
+    0x23, 0x66, 0x00, /* |..###......######...| */
+    0x33, 0x43, 0x22, 0x00, /* |...###....###..##...| */
+    0x48, 0x23, 0x00, /* |....########..###...| */
+    0x56, 0x32, 0x00, /* |.....######...##....| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1449 'R'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x32, 0x00, /* |..##...##...........| */
+    0x22, 0x33, 0x00, /* |..##...###..........| */
+    0x23, 0x16, 0x00, /* |..###.######........| */
+    0x35, 0x14, 0x00, /* |...#####.####.......| */
+    0x43, 0x43, 0x00, /* |....###....###......| */
+    0xC2, 0x00, /* |............##......| */
+    0x00, /* |....................| */
+    // @1484 'S'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x43, 0x34, 0x00, /* |....###...####......| */
+    0x35, 0x24, 0x00, /* |...#####..####......| */
+    0x23, 0x12, 0x32, 0x00, /* |..###.##...##.......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x22, 0x32, 0x32, 0x00, /* |..##...##...##......| */
+    0x32, 0x32, 0x13, 0x00, /* |...##...##.###......| */
+    0x24, 0x25, 0x00, /* |..####..#####.......| */
+    0x24, 0x33, 0x00, /* |..####...###........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1524 'T'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x25, 0x00, /* |..#####.............| */
+    0x25, 0x00, /* |..#####.............| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x25, 0x00, /* |..#####.............| */
+    0x25, 0x00, /* |..#####.............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1552 'U'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x00, /* |..##................| */
+    0x2A, 0x00, /* |..##########........| */
+    0x2B, 0x00, /* |..###########.......| */
+    0x22, 0x73, 0x00, /* |..##.......###......| */
+    0xC2, 0x00, /* |............##......| */
+    0xC2, 0x00, /* |............##......| */
+    0x22, 0x73, 0x00, /* |..##.......###......| */
+    0x2B, 0x00, /* |..###########.......| */
+    0x2A, 0x00, /* |..##########........| */
+    0x22, 0x00, /* |..##................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1578 'V'
+    0x00, /* |....................| */
+    0x22, 0x00, /* |..##................| */
+    0x24, 0x00, /* |..####..............| */
+    0x26, 0x00, /* |..######............| */
+    0x22, 0x25, 0x00, /* |..##..#####.........| */
+    0x86, 0x00, /* |........######......| */
+    0xB3, 0x00, /* |...........###......| */
+    0x86, 0x00, /* |........######......| */
+    0x22, 0x25, 0x00, /* |..##..#####.........| */
+    0x26, 0x00, /* |..######............| */
+    0x24, 0x00, /* |..####..............| */
+    0x22, 0x00, /* |..##................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1605 'W'
+    0x00, /* |....................| */
+    0x22, 0x00, /* |..##................| */
+    0x27, 0x00, /* |..#######...........| */
+    0x2C, 0x00, /* |..############......| */
+    0x22, 0x64, 0x00, /* |..##......####......| */
+    0x22, 0x45, 0x00, /* |..##....#####.......| */
+    0x55, 0x00, /* |.....#####..........| */
+    0x53, 0x00, /* |.....###............| */
+    0x55, 0x00, /* |.....#####..........| */
+    0x22, 0x45, 0x00, /* |..##....#####.......| */
+    0x22, 0x64, 0x00, /* |..##......####......| */
+    0x2C, 0x00, /* |..############......| */
+    0x27, 0x00, /* |..#######...........| */
+    0x22, 0x00, /* |..##................| */
+    // @1636 'X'
+    0x00, /* |....................| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x23, 0x63, 0x00, /* |..###......###......| */
+    0x24, 0x44, 0x00, /* |..####....####......| */
+    0x22, 0x12, 0x22, 0x12, 0x00, /* |..##.##..##.##......| */
+    0x64, 0x00, /* |......####..........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x64, 0x00, /* |......####..........| */
+    0x22, 0x12, 0x22, 0x12, 0x00, /* |..##.##..##.##......| */
+    0x24, 0x44, 0x00, /* |..####....####......| */
+    0x23, 0x63, 0x00, /* |..###......###......| */
+    0x22, 0x82, 0x00, /* |..##........##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1673 'Y'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x22, 0x00, /* |..##................| */
+    0x23, 0x00, /* |..###...............| */
+    0x24, 0x62, 0x00, /* |..####......##......| */
+    0x22, 0x13, 0x42, 0x00, /* |..##.###....##......| */
+    0x68, 0x00, /* |......########......| */
+    0x68, 0x00, /* |......########......| */
+    0x22, 0x13, 0x42, 0x00, /* |..##.###....##......| */
+    0x24, 0x62, 0x00, /* |..####......##......| */
+    0x23, 0x00, /* |..###...............| */
+    0x22, 0x00, /* |..##................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1703 'Z'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x24, 0x53, 0x00, /* |..####.....###......| */
+    0x24, 0x44, 0x00, /* |..####....####......| */
+    0x22, 0x52, 0x12, 0x00, /* |..##.....##.##......| */
+    0x22, 0x33, 0x22, 0x00, /* |..##...###..##......| */
+    0x22, 0x23, 0x32, 0x00, /* |..##..###...##......| */
+    0x22, 0x12, 0x52, 0x00, /* |..##.##.....##......| */
+    0x24, 0x44, 0x00, /* |..####....####......| */
+    0x23, 0x54, 0x00, /* |..###.....####......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1737 '['
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0xF0, 0x01, 0x10, 0x00, /* |.################...| */
+    0xF0, 0x01, 0x10, 0x00, /* |.################...| */
+    0x12, 0xC2, 0x00, /* |.##............##...| */
+    0x12, 0xC2, 0x00, /* |.##............##...| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1761 '\\'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x02, 0x00, /* |##..................| */
+    0x05, 0x00, /* |#####...............| */
+    0x25, 0x00, /* |..#####.............| */
+    0x54, 0x00, /* |.....####...........| */
+    0x74, 0x00, /* |.......####.........| */
+    0x95, 0x00, /* |.........#####......| */
+    0xB5, 0x00, /* |...........#####....| */
+    0xE2, 0x00, /* |..............##....| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1783 ']'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x12, 0xC2, 0x00, /* |.##............##...| */
+    0x12, 0xC2, 0x00, /* |.##............##...| */
+    0xF0, 0x01, 0x10, 0x00, /* |.################...| */
+    0xF0, 0x01, 0x10, 0x00, /* |.################...| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1807 '^'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x52, 0x00, /* |.....##.............| */
+    0x42, 0x00, /* |....##..............| */
+    0x32, 0x00, /* |...##...............| */
+    0x22, 0x00, /* |..##................| */
+    0x12, 0x00, /* |.##.................| */
+    0x22, 0x00, /* |..##................| */
+    0x32, 0x00, /* |...##...............| */
+    0x42, 0x00, /* |....##..............| */
+    0x52, 0x00, /* |.....##.............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1830 '_'
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    0xF0, 0x12, 0x02, 0x00, /* |..................##| */
+    // @1886 '`'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x11, 0x00, /* |.#..................| */
+    0x21, 0x00, /* |..#.................| */
+    0x21, 0x00, /* |..#.................| */
+    0x31, 0x00, /* |...#................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1904 'a'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0xA3, 0x00, /* |..........###.......| */
+    0x61, 0x25, 0x00, /* |......#..#####......| */
+    0x52, 0x13, 0x12, 0x00, /* |.....##.###.##......| */
+    0x52, 0x12, 0x22, 0x00, /* |.....##.##..##......| */
+    0x52, 0x12, 0x22, 0x00, /* |.....##.##..##......| */
+    0x52, 0x12, 0x22, 0x00, /* |.....##.##..##......| */
+    0x52, 0x12, 0x12, 0x00, /* |.....##.##.##.......| */
+    0x59, 0x00, /* |.....#########......| */
+    0x68, 0x00, /* |......########......| */
+    0xC2, 0x00, /* |............##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1939 'b'
+    0x00, /* |....................| */
+    0x12, 0x92, 0x00, /* |.##.........##......| */
+    0x1D, 0x00, /* |.#############......| */
+    0x1D, 0x00, /* |.#############......| */
+    0x62, 0x32, 0x00, /* |......##...##.......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x62, 0x32, 0x00, /* |......##...##.......| */
+    0x67, 0x00, /* |......#######.......| */
+    0x83, 0x00, /* |........###.........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @1971 'c'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x84, 0x00, /* |........####........| */
+    0x67, 0x00, /* |......#######.......| */
+    0x62, 0x33, 0x00, /* |......##...###......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x61, 0x52, 0x00, /* |......#.....##......| */
+    0x54, 0x22, 0x00, /* |.....####..##.......| */
+    0x54, 0x22, 0x00, /* |.....####..##.......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2003 'd'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x84, 0x00, /* |........####........| */
+    0x67, 0x00, /* |......#######.......| */
+    0x62, 0x32, 0x00, /* |......##...##.......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x12, 0x32, 0x32, 0x00, /* |.##...##...##.......| */
+    0x1D, 0x00, /* |.#############......| */
+    0x1D, 0x00, /* |.#############......| */
+    0xC2, 0x00, /* |............##......| */
+    0x00, /* |....................| */
+    // @2035 'e'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x83, 0x00, /* |........###.........| */
+    0x67, 0x00, /* |......#######.......| */
+    0x64, 0x12, 0x00, /* |......####.##.......| */
+    0x52, 0x12, 0x22, 0x00, /* |.....##.##..##......| */
+    0x52, 0x12, 0x22, 0x00, /* |.....##.##..##......| */
+    0x52, 0x12, 0x22, 0x00, /* |.....##.##..##......| */
+    0x52, 0x12, 0x22, 0x00, /* |.....##.##..##......| */
+    0x64, 0x22, 0x00, /* |......####..##......| */
+    0x64, 0x12, 0x00, /* |......####.##.......| */
+    0x82, 0x12, 0x00, /* |........##.##.......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2071 'f'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x2C, 0x00, /* |..############......| */
+    0x1D, 0x00, /* |.#############......| */
+    0x12, 0x22, 0x52, 0x00, /* |.##..##.....##......| */
+    0x12, 0x22, 0x52, 0x00, /* |.##..##.....##......| */
+    0x12, 0x22, 0x52, 0x00, /* |.##..##.....##......| */
+    0x12, 0x22, 0x52, 0x00, /* |.##..##.....##......| */
+    0x12, 0x00, /* |.##.................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2104 'g'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x83, 0x00, /* |........###.........| */
+    0x67, 0x00, /* |......#######.......| */
+    0x62, 0x32, 0x32, 0x00, /* |......##...##...##..| */
+    0x52, 0x52, 0x22, 0x00, /* |.....##.....##..##..| */
+    0x52, 0x52, 0x22, 0x00, /* |.....##.....##..##..| */
+    0x52, 0x52, 0x22, 0x00, /* |.....##.....##..##..| */
+    0x52, 0x52, 0x22, 0x00, /* |.....##.....##..##..| */
+    0x62, 0x32, 0x23, 0x00, /* |......##...##..###..| */
+    0x5C, 0x00, /* |.....############...| */
+    0x5B, 0x00, /* |.....###########....| */
+    0x52, 0x00, /* |.....##.............| */
+    0x00, /* |....................| */
+    // @2141 'h'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x12, 0x92, 0x00, /* |.##.........##......| */
+    0x1D, 0x00, /* |.#############......| */
+    0x1D, 0x00, /* |.#############......| */
+    0x62, 0x42, 0x00, /* |......##....##......| */
+    0x52, 0x00, /* |.....##.............| */
+    0x52, 0x00, /* |.....##.............| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x59, 0x00, /* |.....#########......| */
+    0x68, 0x00, /* |......########......| */
+    0xC2, 0x00, /* |............##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2168 'i'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x12, 0x29, 0x00, /* |.##..#########......| */
+    0x12, 0x29, 0x00, /* |.##..#########......| */
+    0xC2, 0x00, /* |............##......| */
+    0xC2, 0x00, /* |............##......| */
+    0xC2, 0x00, /* |............##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2195 'j'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0xF0, 0x10, 0x02, 0x00, /* |................##..| */
+    0x52, 0x92, 0x00, /* |.....##.........##..| */
+    0x52, 0x92, 0x00, /* |.....##.........##..| */
+    0x52, 0x92, 0x00, /* |.....##.........##..| */
+    0x12, 0x22, 0x92, 0x00, /* |.##..##.........##..| */
+    0x12, 0x22, 0x83, 0x00, /* |.##..##........###..| */
+    0x5C, 0x00, /* |.....############...| */
+    0x5B, 0x00, /* |.....###########....| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2226 'k'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x12, 0x92, 0x00, /* |.##.........##......| */
+    0x1D, 0x00, /* |.#############......| */
+    0x1D, 0x00, /* |.#############......| */
+    0x82, 0x00, /* |........##..........| */
+    0x56, 0x00, /* |.....######.........| */
+    0x53, 0x24, 0x00, /* |.....###..####......| */
+    0x52, 0x43, 0x00, /* |.....##....###......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0xC2, 0x00, /* |............##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2255 'l'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x12, 0x92, 0x00, /* |.##.........##......| */
+    0x12, 0x92, 0x00, /* |.##.........##......| */
+    0x12, 0x92, 0x00, /* |.##.........##......| */
+    0x1D, 0x00, /* |.#############......| */
+    0x1D, 0x00, /* |.#############......| */
+    0xC2, 0x00, /* |............##......| */
+    0xC2, 0x00, /* |............##......| */
+    0xC2, 0x00, /* |............##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2280 'm'
+    0x00, /* |....................| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x59, 0x00, /* |.....#########......| */
+    0x59, 0x00, /* |.....#########......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x00, /* |.....##.............| */
+    0x59, 0x00, /* |.....#########......| */
+    0x68, 0x00, /* |......########......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x00, /* |.....##.............| */
+    0x59, 0x00, /* |.....#########......| */
+    0x68, 0x00, /* |......########......| */
+    0xC2, 0x00, /* |............##......| */
+    0x00, /* |....................| */
+    // @2309 'n'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x59, 0x00, /* |.....#########......| */
+    0x59, 0x00, /* |.....#########......| */
+    0x62, 0x42, 0x00, /* |......##....##......| */
+    0x52, 0x00, /* |.....##.............| */
+    0x52, 0x00, /* |.....##.............| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x59, 0x00, /* |.....#########......| */
+    0x68, 0x00, /* |......########......| */
+    0xC2, 0x00, /* |............##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2336 'o'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x83, 0x00, /* |........###.........| */
+    0x67, 0x00, /* |......#######.......| */
+    0x62, 0x32, 0x00, /* |......##...##.......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x62, 0x32, 0x00, /* |......##...##.......| */
+    0x67, 0x00, /* |......#######.......| */
+    0x83, 0x00, /* |........###.........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2366 'p'
+    0x00, /* |....................| */
+    0x52, 0x92, 0x00, /* |.....##.........##..| */
+    0x5D, 0x00, /* |.....#############..| */
+    0x5D, 0x00, /* |.....#############..| */
+    0x62, 0x32, 0x32, 0x00, /* |......##...##...##..| */
+    0x52, 0x52, 0x22, 0x00, /* |.....##.....##..##..| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x62, 0x32, 0x00, /* |......##...##.......| */
+    0x67, 0x00, /* |......#######.......| */
+    0x83, 0x00, /* |........###.........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2400 'q'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x83, 0x00, /* |........###.........| */
+    0x67, 0x00, /* |......#######.......| */
+    0x62, 0x32, 0x00, /* |......##...##.......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x22, 0x00, /* |.....##.....##..##..| */
+    0x62, 0x32, 0x32, 0x00, /* |......##...##...##..| */
+    0x5D, 0x00, /* |.....#############..| */
+    0x5D, 0x00, /* |.....#############..| */
+    0x52, 0x92, 0x00, /* |.....##.........##..| */
+    0x00, /* |....................| */
+    // @2434 'r'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x59, 0x00, /* |.....#########......| */
+    0x59, 0x00, /* |.....#########......| */
+    0x72, 0x32, 0x00, /* |.......##...##......| */
+    0x62, 0x42, 0x00, /* |......##....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x53, 0x00, /* |.....###............| */
+    0x62, 0x00, /* |......##............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2464 's'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x63, 0x23, 0x00, /* |......###..###......| */
+    0x64, 0x13, 0x00, /* |......####.###......| */
+    0x52, 0x12, 0x22, 0x00, /* |.....##.##..##......| */
+    0x52, 0x12, 0x22, 0x00, /* |.....##.##..##......| */
+    0x52, 0x22, 0x12, 0x00, /* |.....##..##.##......| */
+    0x52, 0x22, 0x12, 0x00, /* |.....##..##.##......| */
+    0x53, 0x14, 0x00, /* |.....###.####.......| */
+    0x53, 0x23, 0x00, /* |.....###..###.......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2498 't'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x52, 0x00, /* |.....##.............| */
+    0x52, 0x00, /* |.....##.............| */
+    0x2B, 0x00, /* |..###########.......| */
+    0x2C, 0x00, /* |..############......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x42, 0x00, /* |.....##....##.......| */
+    0xB2, 0x00, /* |...........##.......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2527 'u'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x52, 0x00, /* |.....##.............| */
+    0x58, 0x00, /* |.....########.......| */
+    0x59, 0x00, /* |.....#########......| */
+    0xC2, 0x00, /* |............##......| */
+    0xC2, 0x00, /* |............##......| */
+    0xC2, 0x00, /* |............##......| */
+    0x52, 0x42, 0x00, /* |.....##....##.......| */
+    0x59, 0x00, /* |.....#########......| */
+    0x59, 0x00, /* |.....#########......| */
+    0xC2, 0x00, /* |............##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2552 'v'
+    0x00, /* |....................| */
+    0x52, 0x00, /* |.....##.............| */
+    0x53, 0x00, /* |.....###............| */
+    0x55, 0x00, /* |.....#####..........| */
+    0x52, 0x14, 0x00, /* |.....##.####........| */
+    0xA4, 0x00, /* |..........####......| */
+    0xC2, 0x00, /* |............##......| */
+    0xA4, 0x00, /* |..........####......| */
+    0x52, 0x14, 0x00, /* |.....##.####........| */
+    0x55, 0x00, /* |.....#####..........| */
+    0x53, 0x00, /* |.....###............| */
+    0x52, 0x00, /* |.....##.............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2579 'w'
+    0x00, /* |....................| */
+    0x52, 0x00, /* |.....##.............| */
+    0x55, 0x00, /* |.....#####..........| */
+    0x59, 0x00, /* |.....#########......| */
+    0x52, 0x34, 0x00, /* |.....##...####......| */
+    0x93, 0x00, /* |.........###........| */
+    0x73, 0x00, /* |.......###..........| */
+    0x93, 0x00, /* |.........###........| */
+    0x52, 0x25, 0x00, /* |.....##..#####......| */
+    0x59, 0x00, /* |.....#########......| */
+    0x55, 0x00, /* |.....#####..........| */
+    0x52, 0x00, /* |.....##.............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2606 'x'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x53, 0x33, 0x00, /* |.....###...###......| */
+    0x54, 0x14, 0x00, /* |.....####.####......| */
+    0x83, 0x00, /* |........###.........| */
+    0x83, 0x00, /* |........###.........| */
+    0x54, 0x14, 0x00, /* |.....####.####......| */
+    0x53, 0x33, 0x00, /* |.....###...###......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x52, 0x52, 0x00, /* |.....##.....##......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2638 'y'
+    0x00, /* |....................| */
+    0x52, 0x92, 0x00, /* |.....##.........##..| */
+    0x53, 0x82, 0x00, /* |.....###........##..| */
+    0x55, 0x62, 0x00, /* |.....#####......##..| */
+    0x52, 0x14, 0x33, 0x00, /* |.....##.####...###..| */
+    0xA8, 0x00, /* |..........########..| */
+    0xB4, 0x12, 0x00, /* |...........####.##..| */
+    0xA3, 0x32, 0x00, /* |..........###...##..| */
+    0x52, 0x14, 0x00, /* |.....##.####........| */
+    0x55, 0x00, /* |.....#####..........| */
+    0x53, 0x00, /* |.....###............| */
+    0x52, 0x00, /* |.....##.............| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2671 'z'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x53, 0x42, 0x00, /* |.....###....##......| */
+    0x53, 0x33, 0x00, /* |.....###...###......| */
+    0x52, 0x34, 0x00, /* |.....##...####......| */
+    0x52, 0x22, 0x12, 0x00, /* |.....##..##.##......| */
+    0x52, 0x12, 0x22, 0x00, /* |.....##.##..##......| */
+    0x54, 0x32, 0x00, /* |.....####...##......| */
+    0x53, 0x33, 0x00, /* |.....###...###......| */
+    0x52, 0x43, 0x00, /* |.....##....###......| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2703 '{'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x91, 0x00, /* |.........#..........| */
+    0x83, 0x00, /* |........###.........| */
+    0x2E, 0x00, /* |..##############....| */
+    0x18, 0x17, 0x00, /* |.########.#######...| */
+    0x12, 0xC2, 0x00, /* |.##............##...| */
+    0x12, 0xC2, 0x00, /* |.##............##...| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2726 '|'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0xF0, 0x01, 0x10, 0x00, /* |.################...| */
+    0xF0, 0x01, 0x10, 0x00, /* |.################...| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2746 '}'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x12, 0xC2, 0x00, /* |.##............##...| */
+    0x12, 0xC2, 0x00, /* |.##............##...| */
+    0x18, 0x17, 0x00, /* |.########.#######...| */
+    0x2E, 0x00, /* |..##############....| */
+    0x83, 0x00, /* |........###.........| */
+    0x91, 0x00, /* |.........#..........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    // @2769 '~'
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+    0x72, 0x00, /* |.......##...........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x62, 0x00, /* |......##............| */
+    0x62, 0x00, /* |......##............| */
+    0x63, 0x00, /* |......###...........| */
+    0x73, 0x00, /* |.......###..........| */
+    0x82, 0x00, /* |........##..........| */
+    0x82, 0x00, /* |........##..........| */
+    0x73, 0x00, /* |.......###..........| */
+    0x72, 0x00, /* |.......##...........| */
+    0x00, /* |....................| */
+    0x00, /* |....................| */
+};
+
+const uint16_t Font20_SpanIndex[] = {
+    0, 14, 34, 54, 92, 126, 165, 199, 216, 236, 256, 280,
+    304, 322, 345, 362, 384, 412, 437, 473, 509, 539, 573, 608,
+    634, 669, 704, 724, 745, 777, 813, 845, 873, 905, 939, 974,
+    1006, 1038, 1074, 1106, 1142, 1172, 1200, 1228, 1263, 1291, 1323, 1352,
+    1382, 1415, 1449, 1484, 1524, 1552, 1578, 1605, 1636, 1673, 1703, 1737,
+    1761, 1783, 1807, 1830, 1886, 1904, 1939, 1971, 2003, 2035, 2071, 2104,
+    2141, 2168, 2195, 2226, 2255, 2280, 2309, 2336, 2366, 2400, 2434, 2464,
+    2498, 2527, 2552, 2579, 2606, 2638, 2671, 2703, 2726, 2746, 2769,
+};
+
+sFONT Font20 = {
+    NULL,
+    14, /* Width */
+    20, /* Height */
+    Font20_Spans,
+    Font20_SpanIndex,
+    0x20, /* FirstChar */
+    95, /* CharCount */
+};
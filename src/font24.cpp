@@ -1,2520 +1,1741 @@
-/**
-  ******************************************************************************
-  * @file    font24.c
-  * @author  MCD Application Team
-  * @version V1.0.0
-  * @date    18-February-2014
-  * @brief   This file provides text font24 for STM32xx-EVAL's LCD driver. 
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
-  *
-  * Redistribution and use in source and binary forms, with or without modification,
-  * are permitted provided that the following conditions are met:
-  *   1. Redistributions of source code must retain the above copyright notice,
-  *      this list of conditions and the following disclaimer.
-  *   2. Redistributions in binary form must reproduce the above copyright notice,
-  *      this list of conditions and the following disclaimer in the documentation
-  *      and/or other materials provided with the distribution.
-  *   3. Neither the name of STMicroelectronics nor the names of its contributors
-  *      may be used to endorse or promote products derived from this software
-  *      without specific prior written permission.
-  *
-  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-  *
-  ******************************************************************************
-  */
-
-/* Includes ------------------------------------------------------------------*/
-#include "fonts.h"
-
-const uint8_t Font24_Table [] = 
-{
-	// @0 ' ' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @72 '!' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x01, 0x00, 0x00, //        #         
-	0x01, 0x00, 0x00, //        #         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @144 '"' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x0E, 0x70, 0x00, //     ###  ###     
-	0x0E, 0x70, 0x00, //     ###  ###     
-	0x0E, 0x70, 0x00, //     ###  ###     
-	0x04, 0x20, 0x00, //      #    #      
-	0x04, 0x20, 0x00, //      #    #      
-	0x04, 0x20, 0x00, //      #    #      
-	0x04, 0x20, 0x00, //      #    #      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @216 '#' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @288 '$' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x07, 0xB0, 0x00, //      #### ##     
-	0x0F, 0xF0, 0x00, //     ########     
-	0x18, 0x70, 0x00, //    ##    ###     
-	0x18, 0x70, 0x00, //    ##    ###     
-	0x1C, 0x00, 0x00, //    ###           
-	0x0F, 0x80, 0x00, //     #####        
-	0x07, 0xE0, 0x00, //      ######      
-	0x00, 0xF0, 0x00, //         ####     
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x1C, 0x30, 0x00, //    ###    ##     
-	0x1C, 0x70, 0x00, //    ###   ###     
-	0x1F, 0xE0, 0x00, //    ########      
-	0x1B, 0xC0, 0x00, //    ## ####       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @360 '%' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0x80, 0x00, //      ####        
-	0x0F, 0xC0, 0x00, //     ######       
-	0x1C, 0xE0, 0x00, //    ###  ###      
-	0x18, 0x60, 0x00, //    ##    ##      
-	0x18, 0x60, 0x00, //    ##    ##      
-	0x1C, 0xE0, 0x00, //    ###  ###      
-	0x0F, 0xF8, 0x00, //     #########    
-	0x07, 0xE0, 0x00, //      ######      
-	0x1F, 0xF0, 0x00, //    #########     
-	0x07, 0x38, 0x00, //      ###  ###    
-	0x06, 0x18, 0x00, //      ##    ##    
-	0x06, 0x18, 0x00, //      ##    ##    
-	0x07, 0x38, 0x00, //      ###  ###    
-	0x03, 0xF0, 0x00, //       ######     
-	0x01, 0xE0, 0x00, //        ####      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @432 '&' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xF0, 0x00, //       ######     
-	0x07, 0xF0, 0x00, //      #######     
-	0x0C, 0x60, 0x00, //     ##   ##      
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x06, 0x00, 0x00, //      ##          
-	0x07, 0x00, 0x00, //      ###         
-	0x0F, 0x9C, 0x00, //     #####  ###   
-	0x1D, 0xFC, 0x00, //    ### #######   
-	0x18, 0xF0, 0x00, //    ##   ####     
-	0x18, 0x70, 0x00, //    ##    ###     
-	0x0F, 0xFC, 0x00, //     ##########   
-	0x07, 0xDC, 0x00, //      ##### ###   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @504 ''' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x01, 0x00, 0x00, //        #         
-	0x01, 0x00, 0x00, //        #         
-	0x01, 0x00, 0x00, //        #         
-	0x01, 0x00, 0x00, //        #         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @576 '(' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x38, 0x00, //           ###    
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0xF0, 0x00, //         ####     
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0xE0, 0x00, //         ###      
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0xC0, 0x00, //        ###       
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0x38, 0x00, //           ###    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @648 ')' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x18, 0x00, 0x00, //    ##            
-	0x1C, 0x00, 0x00, //    ###           
-	0x0E, 0x00, 0x00, //     ###          
-	0x0E, 0x00, 0x00, //     ###          
-	0x07, 0x00, 0x00, //      ###         
-	0x07, 0x00, 0x00, //      ###         
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x07, 0x00, 0x00, //      ###         
-	0x07, 0x00, 0x00, //      ###         
-	0x0F, 0x00, 0x00, //     ####         
-	0x0E, 0x00, 0x00, //     ###          
-	0x1C, 0x00, 0x00, //    ###           
-	0x18, 0x00, 0x00, //    ##            
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @720 '*' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x1D, 0xB8, 0x00, //    ### ## ###    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x07, 0xE0, 0x00, //      ######      
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @792 '+' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x3F, 0xFC, 0x00, //   ############   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @864 ',' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0xC0, 0x00, //         ##       
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x00, 0x00, //       ##         
-	0x03, 0x00, 0x00, //       ##         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @936 '-' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1008 '.' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1080 '/' (17 pixels wide)
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x38, 0x00, //           ###    
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0xC0, 0x00, //         ##       
-	0x00, 0xC0, 0x00, //         ##       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x00, 0x00, //       ##         
-	0x03, 0x00, 0x00, //       ##         
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x0E, 0x00, 0x00, //     ###          
-	0x0C, 0x00, 0x00, //     ##           
-	0x1C, 0x00, 0x00, //    ###           
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1152 '0' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x07, 0xE0, 0x00, //      ######      
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x07, 0xE0, 0x00, //      ######      
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1224 '1' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x80, 0x00, //         #        
-	0x07, 0x80, 0x00, //      ####        
-	0x1F, 0x80, 0x00, //    ######        
-	0x1D, 0x80, 0x00, //    ### ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1296 '2' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xC0, 0x00, //      #####       
-	0x1F, 0xF0, 0x00, //    #########     
-	0x38, 0x30, 0x00, //   ###     ##     
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x60, 0x00, //          ##      
-	0x01, 0xC0, 0x00, //        ###       
-	0x03, 0x80, 0x00, //       ###        
-	0x06, 0x00, 0x00, //      ##          
-	0x0C, 0x00, 0x00, //     ##           
-	0x18, 0x00, 0x00, //    ##            
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1368 '3' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x0F, 0xE0, 0x00, //     #######      
-	0x0C, 0x70, 0x00, //     ##   ###     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x60, 0x00, //          ##      
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xE0, 0x00, //       #####      
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xF0, 0x00, //    #########     
-	0x0F, 0xC0, 0x00, //     ######       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1440 '4' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xE0, 0x00, //         ###      
-	0x01, 0xE0, 0x00, //        ####      
-	0x01, 0xE0, 0x00, //        ####      
-	0x03, 0x60, 0x00, //       ## ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x0C, 0x60, 0x00, //     ##   ##      
-	0x0C, 0x60, 0x00, //     ##   ##      
-	0x18, 0x60, 0x00, //    ##    ##      
-	0x30, 0x60, 0x00, //   ##     ##      
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x00, 0x60, 0x00, //          ##      
-	0x03, 0xF8, 0x00, //       #######    
-	0x03, 0xF8, 0x00, //       #######    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1512 '5' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1F, 0xF0, 0x00, //    #########     
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x1B, 0xC0, 0x00, //    ## ####       
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1C, 0x30, 0x00, //    ###    ##     
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x30, 0x30, 0x00, //   ##      ##     
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x0F, 0xC0, 0x00, //     ######       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1584 '6' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xF8, 0x00, //         #####    
-	0x03, 0xF8, 0x00, //       #######    
-	0x07, 0x00, 0x00, //      ###         
-	0x0E, 0x00, 0x00, //     ###          
-	0x0C, 0x00, 0x00, //     ##           
-	0x18, 0x00, 0x00, //    ##            
-	0x1B, 0xC0, 0x00, //    ## ####       
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1C, 0x30, 0x00, //    ###    ##     
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x38, 0x00, //     ##    ###    
-	0x0F, 0xF0, 0x00, //     ########     
-	0x03, 0xE0, 0x00, //       #####      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1656 '7' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0xC0, 0x00, //         ##       
-	0x00, 0xC0, 0x00, //         ##       
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1728 '8' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xE0, 0x00, //      ######      
-	0x0F, 0xF0, 0x00, //     ########     
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x07, 0xE0, 0x00, //      ######      
-	0x07, 0xE0, 0x00, //      ######      
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x0F, 0xF0, 0x00, //     ########     
-	0x07, 0xE0, 0x00, //      ######      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1800 '9' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xC0, 0x00, //      #####       
-	0x0F, 0xF0, 0x00, //     ########     
-	0x1C, 0x30, 0x00, //    ###    ##     
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x38, 0x00, //     ##    ###    
-	0x0F, 0xF8, 0x00, //     #########    
-	0x03, 0xD8, 0x00, //       #### ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0xE0, 0x00, //         ###      
-	0x1F, 0xC0, 0x00, //    #######       
-	0x1F, 0x00, 0x00, //    #####         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1872 ':' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1944 ';' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xF0, 0x00, //         ####     
-	0x00, 0xF0, 0x00, //         ####     
-	0x00, 0xF0, 0x00, //         ####     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xE0, 0x00, //         ###      
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x00, 0x00, //       ##         
-	0x02, 0x00, 0x00, //       #          
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2016 '<' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x1C, 0x00, //            ###   
-	0x00, 0x3C, 0x00, //           ####   
-	0x00, 0xF0, 0x00, //         ####     
-	0x03, 0xC0, 0x00, //       ####       
-	0x0F, 0x00, 0x00, //     ####         
-	0x3C, 0x00, 0x00, //   ####           
-	0xF0, 0x00, 0x00, // ####             
-	0x3C, 0x00, 0x00, //   ####           
-	0x0F, 0x00, 0x00, //     ####         
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0xF0, 0x00, //         ####     
-	0x00, 0x3C, 0x00, //           ####   
-	0x00, 0x1C, 0x00, //            ###   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2088 '=' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0xFC, 0x00, //  #############   
-	0x7F, 0xFC, 0x00, //  #############   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0xFC, 0x00, //  #############   
-	0x7F, 0xFC, 0x00, //  #############   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2160 '>' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x70, 0x00, 0x00, //  ###             
-	0x78, 0x00, 0x00, //  ####            
-	0x1E, 0x00, 0x00, //    ####          
-	0x07, 0x80, 0x00, //      ####        
-	0x01, 0xE0, 0x00, //        ####      
-	0x00, 0x78, 0x00, //          ####    
-	0x00, 0x1E, 0x00, //            ####  
-	0x00, 0x78, 0x00, //          ####    
-	0x01, 0xE0, 0x00, //        ####      
-	0x07, 0x80, 0x00, //      ####        
-	0x1E, 0x00, 0x00, //    ####          
-	0x78, 0x00, 0x00, //  ####            
-	0x70, 0x00, 0x00, //  ###             
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2232 '?' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xC0, 0x00, //      #####       
-	0x0F, 0xE0, 0x00, //     #######      
-	0x18, 0x70, 0x00, //    ##    ###     
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0xE0, 0x00, //         ###      
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x00, 0x00, //       ##         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0x00, 0x00, //      ###         
-	0x07, 0x00, 0x00, //      ###         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2304 '@' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xE0, 0x00, //       #####      
-	0x07, 0xF0, 0x00, //      #######     
-	0x0E, 0x38, 0x00, //     ###   ###    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x18, 0x78, 0x00, //    ##    ####    
-	0x18, 0xF8, 0x00, //    ##   #####    
-	0x19, 0xD8, 0x00, //    ##  ### ##    
-	0x19, 0x98, 0x00, //    ##  ##  ##    
-	0x19, 0x98, 0x00, //    ##  ##  ##    
-	0x19, 0x98, 0x00, //    ##  ##  ##    
-	0x18, 0xF8, 0x00, //    ##   #####    
-	0x18, 0x78, 0x00, //    ##    ####    
-	0x18, 0x00, 0x00, //    ##            
-	0x0C, 0x00, 0x00, //     ##           
-	0x0E, 0x18, 0x00, //     ###    ##    
-	0x07, 0xF8, 0x00, //      ########    
-	0x03, 0xE0, 0x00, //       #####      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2376 'A' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0x80, 0x00, //    ######        
-	0x1F, 0xC0, 0x00, //    #######       
-	0x01, 0xC0, 0x00, //        ###       
-	0x03, 0x60, 0x00, //       ## ##      
-	0x03, 0x60, 0x00, //       ## ##      
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x0F, 0xF8, 0x00, //     #########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0xFC, 0x7F, 0x00, // ######   ####### 
-	0xFC, 0x7F, 0x00, // ######   ####### 
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2448 'B' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0xE0, 0x00, //  ##########      
-	0x7F, 0xF0, 0x00, //  ###########     
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x1C, 0x00, //    ##      ###   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x7F, 0xF8, 0x00, //  ############    
-	0x7F, 0xF0, 0x00, //  ###########     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2520 'C' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xEC, 0x00, //       ##### ##   
-	0x0F, 0xFC, 0x00, //     ##########   
-	0x1C, 0x1C, 0x00, //    ###     ###   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x1C, 0x1C, 0x00, //    ###     ###   
-	0x0F, 0xF8, 0x00, //     #########    
-	0x03, 0xF0, 0x00, //       ######     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2592 'D' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0xC0, 0x00, //  #########       
-	0x7F, 0xF0, 0x00, //  ###########     
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x7F, 0xF0, 0x00, //  ###########     
-	0x7F, 0xE0, 0x00, //  ##########      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2664 'E' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0xF8, 0x00, //  ############    
-	0x7F, 0xF8, 0x00, //  ############    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x19, 0x98, 0x00, //    ##  ##  ##    
-	0x19, 0x80, 0x00, //    ##  ##        
-	0x1F, 0x80, 0x00, //    ######        
-	0x1F, 0x80, 0x00, //    ######        
-	0x19, 0x80, 0x00, //    ##  ##        
-	0x19, 0x98, 0x00, //    ##  ##  ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x7F, 0xF8, 0x00, //  ############    
-	0x7F, 0xF8, 0x00, //  ############    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2736 'F' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x3F, 0xFC, 0x00, //   ############   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0xCC, 0x00, //     ##  ##  ##   
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0F, 0xC0, 0x00, //     ######       
-	0x0F, 0xC0, 0x00, //     ######       
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x3F, 0xC0, 0x00, //   ########       
-	0x3F, 0xC0, 0x00, //   ########       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2808 'G' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xEC, 0x00, //       ##### ##   
-	0x0F, 0xFC, 0x00, //     ##########   
-	0x1C, 0x1C, 0x00, //    ###     ###   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0xFE, 0x00, //   ##    #######  
-	0x30, 0xFE, 0x00, //   ##    #######  
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x38, 0x0C, 0x00, //   ###       ##   
-	0x1C, 0x1C, 0x00, //    ###     ###   
-	0x0F, 0xFC, 0x00, //     ##########   
-	0x03, 0xF0, 0x00, //       ######     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2880 'H' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2952 'I' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3024 'J' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xFE, 0x00, //      ##########  
-	0x07, 0xFE, 0x00, //      ##########  
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x30, 0x30, 0x00, //   ##      ##     
-	0x30, 0x30, 0x00, //   ##      ##     
-	0x30, 0x30, 0x00, //   ##      ##     
-	0x30, 0x30, 0x00, //   ##      ##     
-	0x30, 0x60, 0x00, //   ##     ##      
-	0x3F, 0xE0, 0x00, //   #########      
-	0x0F, 0x80, 0x00, //     #####        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3096 'K' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0x3E, 0x00, //  #######  #####  
-	0x7F, 0x3E, 0x00, //  #######  #####  
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x18, 0x60, 0x00, //    ##    ##      
-	0x18, 0xC0, 0x00, //    ##   ##       
-	0x19, 0x80, 0x00, //    ##  ##        
-	0x1B, 0x80, 0x00, //    ## ###        
-	0x1F, 0xC0, 0x00, //    #######       
-	0x1C, 0xE0, 0x00, //    ###  ###      
-	0x18, 0x70, 0x00, //    ##    ###     
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x7F, 0x1F, 0x00, //  #######   ##### 
-	0x7F, 0x1F, 0x00, //  #######   ##### 
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3168 'L' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0x80, 0x00, //  ########        
-	0x7F, 0x80, 0x00, //  ########        
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x7F, 0xFC, 0x00, //  #############   
-	0x7F, 0xFC, 0x00, //  #############   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3240 'M' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0xF0, 0x0F, 0x00, // ####        #### 
-	0xF8, 0x1F, 0x00, // #####      ##### 
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x3C, 0x3C, 0x00, //   ####    ####   
-	0x3C, 0x3C, 0x00, //   ####    ####   
-	0x36, 0x6C, 0x00, //   ## ##  ## ##   
-	0x36, 0x6C, 0x00, //   ## ##  ## ##   
-	0x33, 0xCC, 0x00, //   ##  ####  ##   
-	0x33, 0xCC, 0x00, //   ##  ####  ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0xFE, 0x7F, 0x00, // #######  ####### 
-	0xFE, 0x7F, 0x00, // #######  ####### 
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3312 'N' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x78, 0xFE, 0x00, //  ####   #######  
-	0x78, 0xFE, 0x00, //  ####   #######  
-	0x1C, 0x18, 0x00, //    ###     ##    
-	0x1E, 0x18, 0x00, //    ####    ##    
-	0x1F, 0x18, 0x00, //    #####   ##    
-	0x1B, 0x18, 0x00, //    ## ##   ##    
-	0x1B, 0x98, 0x00, //    ## ###  ##    
-	0x19, 0xD8, 0x00, //    ##  ### ##    
-	0x18, 0xD8, 0x00, //    ##   ## ##    
-	0x18, 0xF8, 0x00, //    ##   #####    
-	0x18, 0x78, 0x00, //    ##    ####    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x7F, 0x18, 0x00, //  #######   ##    
-	0x7F, 0x18, 0x00, //  #######   ##    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3384 'O' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x0F, 0xF0, 0x00, //     ########     
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x0F, 0xF0, 0x00, //     ########     
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3456 'P' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x0C, 0x1C, 0x00, //     ##     ###   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x0F, 0xF8, 0x00, //     #########    
-	0x0F, 0xE0, 0x00, //     #######      
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x3F, 0xC0, 0x00, //   ########       
-	0x3F, 0xC0, 0x00, //   ########       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3528 'Q' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x0F, 0xF0, 0x00, //     ########     
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x0F, 0xF0, 0x00, //     ########     
-	0x07, 0xC0, 0x00, //      #####       
-	0x07, 0xCC, 0x00, //      #####  ##   
-	0x0F, 0xFC, 0x00, //     ##########   
-	0x0C, 0x38, 0x00, //     ##    ###    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3600 'R' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0xE0, 0x00, //  ##########      
-	0x7F, 0xF0, 0x00, //  ###########     
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1F, 0xC0, 0x00, //    #######       
-	0x18, 0xE0, 0x00, //    ##   ###      
-	0x18, 0x70, 0x00, //    ##    ###     
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x7F, 0x1E, 0x00, //  #######   ####  
-	0x7F, 0x0E, 0x00, //  #######    ###  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3672 'S' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xD8, 0x00, //      ##### ##    
-	0x0F, 0xF8, 0x00, //     #########    
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1E, 0x00, 0x00, //    ####          
-	0x0F, 0xC0, 0x00, //     ######       
-	0x03, 0xF0, 0x00, //       ######     
-	0x00, 0x78, 0x00, //          ####    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1B, 0xE0, 0x00, //    ## #####      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3744 'T' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x3F, 0xFC, 0x00, //   ############   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x0F, 0xF0, 0x00, //     ########     
-	0x0F, 0xF0, 0x00, //     ########     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3816 'U' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x0F, 0xF0, 0x00, //     ########     
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3888 'V' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0x7F, 0x00, //  ####### ####### 
-	0x7F, 0x7F, 0x00, //  ####### ####### 
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x03, 0x60, 0x00, //       ## ##      
-	0x03, 0x60, 0x00, //       ## ##      
-	0x03, 0x60, 0x00, //       ## ##      
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0xC0, 0x00, //        ###       
-	0x00, 0x80, 0x00, //         #        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3960 'W' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0xFE, 0x3F, 0x80, // #######   #######
-	0xFE, 0x3F, 0x80, // #######   #######
-	0x30, 0x06, 0x00, //   ##         ##  
-	0x30, 0x06, 0x00, //   ##         ##  
-	0x30, 0x86, 0x00, //   ##    #    ##  
-	0x19, 0xCC, 0x00, //    ##  ###  ##   
-	0x19, 0xCC, 0x00, //    ##  ###  ##   
-	0x1B, 0x6C, 0x00, //    ## ## ## ##   
-	0x1B, 0x6C, 0x00, //    ## ## ## ##   
-	0x1E, 0x7C, 0x00, //    ####  #####   
-	0x0E, 0x38, 0x00, //     ###   ###    
-	0x0E, 0x38, 0x00, //     ###   ###    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4032 'X' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x03, 0xC0, 0x00, //       ####       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0xC0, 0x00, //       ####       
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4104 'Y' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7C, 0x7E, 0x00, //  #####   ######  
-	0x7C, 0x7E, 0x00, //  #####   ######  
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x03, 0xC0, 0x00, //       ####       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x0F, 0xF0, 0x00, //     ########     
-	0x0F, 0xF0, 0x00, //     ########     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4176 'Z' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x18, 0x60, 0x00, //    ##    ##      
-	0x18, 0xC0, 0x00, //    ##   ##       
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x00, 0x00, //       ##         
-	0x06, 0x18, 0x00, //      ##    ##    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4248 '[' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x01, 0xF0, 0x00, //        #####     
-	0x01, 0xF0, 0x00, //        #####     
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0xF0, 0x00, //        #####     
-	0x01, 0xF0, 0x00, //        #####     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4320 '\' (17 pixels wide)
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x1C, 0x00, 0x00, //    ###           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0E, 0x00, 0x00, //     ###          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x03, 0x00, 0x00, //       ##         
-	0x03, 0x00, 0x00, //       ##         
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x00, 0xC0, 0x00, //         ##       
-	0x00, 0xC0, 0x00, //         ##       
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x38, 0x00, //           ###    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4392 ']' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x0F, 0x80, 0x00, //     #####        
-	0x0F, 0x80, 0x00, //     #####        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x0F, 0x80, 0x00, //     #####        
-	0x0F, 0x80, 0x00, //     #####        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4464 '^' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x80, 0x00, //         #        
-	0x01, 0xC0, 0x00, //        ###       
-	0x03, 0xE0, 0x00, //       #####      
-	0x07, 0x70, 0x00, //      ### ###     
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x10, 0x04, 0x00, //    #         #   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4536 '_' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0xFF, 0xFF, 0x00, // ################ 
-	0xFF, 0xFF, 0x00, // ################ 
-
-	// @4608 '`' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x03, 0x00, 0x00, //       ##         
-	0x03, 0x80, 0x00, //       ###        
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4680 'a' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x0F, 0xC0, 0x00, //     ######       
-	0x1F, 0xE0, 0x00, //    ########      
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x07, 0xF0, 0x00, //      #######     
-	0x1F, 0xF0, 0x00, //    #########     
-	0x38, 0x30, 0x00, //   ###     ##     
-	0x30, 0x30, 0x00, //   ##      ##     
-	0x30, 0x70, 0x00, //   ##     ###     
-	0x1F, 0xFC, 0x00, //    ###########   
-	0x0F, 0xBC, 0x00, //     ##### ####   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4752 'b' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x78, 0x00, 0x00, //  ####            
-	0x78, 0x00, 0x00, //  ####            
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x1B, 0xE0, 0x00, //    ## #####      
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1C, 0x18, 0x00, //    ###     ##    
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x1C, 0x18, 0x00, //    ###     ##    
-	0x7F, 0xF8, 0x00, //  ############    
-	0x7B, 0xE0, 0x00, //  #### #####      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4824 'c' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xEC, 0x00, //       ##### ##   
-	0x0F, 0xFC, 0x00, //     ##########   
-	0x1C, 0x1C, 0x00, //    ###     ###   
-	0x38, 0x0C, 0x00, //   ###       ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x38, 0x0C, 0x00, //   ###       ##   
-	0x1C, 0x1C, 0x00, //    ###     ###   
-	0x0F, 0xF8, 0x00, //     #########    
-	0x03, 0xF0, 0x00, //       ######     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4896 'd' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x78, 0x00, //          ####    
-	0x00, 0x78, 0x00, //          ####    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x07, 0xD8, 0x00, //      ##### ##    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xFE, 0x00, //    ############  
-	0x07, 0xDE, 0x00, //      ##### ####  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4968 'e' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xE0, 0x00, //      ######      
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x1F, 0xFC, 0x00, //    ###########   
-	0x07, 0xF0, 0x00, //      #######     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5040 'f' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x01, 0xFC, 0x00, //        #######   
-	0x03, 0xFC, 0x00, //       ########   
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5112 'g' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xDE, 0x00, //      ##### ####  
-	0x1F, 0xFE, 0x00, //    ############  
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x07, 0xD8, 0x00, //      ##### ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x38, 0x00, //           ###    
-	0x0F, 0xF0, 0x00, //     ########     
-	0x0F, 0xC0, 0x00, //     ######       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5184 'h' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x78, 0x00, 0x00, //  ####            
-	0x78, 0x00, 0x00, //  ####            
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x1B, 0xE0, 0x00, //    ## #####      
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5256 'i' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0x80, 0x00, //    ######        
-	0x1F, 0x80, 0x00, //    ######        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x3F, 0xFC, 0x00, //   ############   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5328 'j' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xC0, 0x00, //         ##       
-	0x00, 0xC0, 0x00, //         ##       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1F, 0xF0, 0x00, //    #########     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x70, 0x00, //          ###     
-	0x1F, 0xE0, 0x00, //    ########      
-	0x1F, 0x80, 0x00, //    ######        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5400 'k' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x3C, 0x00, 0x00, //   ####           
-	0x3C, 0x00, 0x00, //   ####           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0xF8, 0x00, //     ##  #####    
-	0x0C, 0xF8, 0x00, //     ##  #####    
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0D, 0x80, 0x00, //     ## ##        
-	0x0F, 0x80, 0x00, //     #####        
-	0x0F, 0x00, 0x00, //     ####         
-	0x0F, 0x80, 0x00, //     #####        
-	0x0D, 0xC0, 0x00, //     ## ###       
-	0x0C, 0xE0, 0x00, //     ##  ###      
-	0x3C, 0x7C, 0x00, //   ####   #####   
-	0x3C, 0x7C, 0x00, //   ####   #####   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5472 'l' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0x80, 0x00, //    ######        
-	0x1F, 0x80, 0x00, //    ######        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x3F, 0xFC, 0x00, //   ############   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5544 'm' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0xF7, 0x78, 0x00, // #### ### ####    
-	0xFF, 0xFC, 0x00, // ##############   
-	0x39, 0xCC, 0x00, //   ###  ###  ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0xFD, 0xEF, 0x00, // ###### #### #### 
-	0xFD, 0xEF, 0x00, // ###### #### #### 
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5616 'n' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7B, 0xE0, 0x00, //  #### #####      
-	0x7F, 0xF0, 0x00, //  ###########     
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5688 'o' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x0F, 0xF0, 0x00, //     ########     
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x0F, 0xF0, 0x00, //     ########     
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5760 'p' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7B, 0xE0, 0x00, //  #### #####      
-	0x7F, 0xF8, 0x00, //  ############    
-	0x1C, 0x18, 0x00, //    ###     ##    
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x1C, 0x18, 0x00, //    ###     ##    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1B, 0xE0, 0x00, //    ## #####      
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x7F, 0x00, 0x00, //  #######         
-	0x7F, 0x00, 0x00, //  #######         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5832 'q' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xDE, 0x00, //      ##### ####  
-	0x1F, 0xFE, 0x00, //    ############  
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x07, 0xD8, 0x00, //      ##### ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0xFE, 0x00, //         #######  
-	0x00, 0xFE, 0x00, //         #######  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5904 'r' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x3E, 0x78, 0x00, //   #####  ####    
-	0x3E, 0xFC, 0x00, //   ##### ######   
-	0x07, 0xCC, 0x00, //      #####  ##   
-	0x07, 0x00, 0x00, //      ###         
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5976 's' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xF8, 0x00, //      ########    
-	0x0F, 0xF8, 0x00, //     #########    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1F, 0x80, 0x00, //    ######        
-	0x0F, 0xF0, 0x00, //     ########     
-	0x00, 0xF8, 0x00, //         #####    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1F, 0xE0, 0x00, //    ########      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6048 't' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x1C, 0x00, //     ##     ###   
-	0x07, 0xFC, 0x00, //      #########   
-	0x03, 0xF0, 0x00, //       ######     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6120 'u' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x78, 0x78, 0x00, //  ####    ####    
-	0x78, 0x78, 0x00, //  ####    ####    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x0F, 0xFE, 0x00, //     ###########  
-	0x07, 0xDE, 0x00, //      ##### ####  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6192 'v' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7C, 0x3E, 0x00, //  #####    #####  
-	0x7C, 0x3E, 0x00, //  #####    #####  
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x07, 0xE0, 0x00, //      ######      
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6264 'w' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x78, 0x3C, 0x00, //  ####     ####   
-	0x78, 0x3C, 0x00, //  ####     ####   
-	0x31, 0x18, 0x00, //   ##   #   ##    
-	0x33, 0x98, 0x00, //   ##  ###  ##    
-	0x33, 0x98, 0x00, //   ##  ###  ##    
-	0x1A, 0xB0, 0x00, //    ## # # ##     
-	0x1E, 0xF0, 0x00, //    #### ####     
-	0x1E, 0xF0, 0x00, //    #### ####     
-	0x1C, 0x60, 0x00, //    ###   ##      
-	0x0C, 0x60, 0x00, //     ##   ##      
-	0x0C, 0x60, 0x00, //     ##   ##      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6336 'x' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x3E, 0x7C, 0x00, //   #####  #####   
-	0x3E, 0x7C, 0x00, //   #####  #####   
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x03, 0xC0, 0x00, //       ####       
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0xC0, 0x00, //       ####       
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x3E, 0x7C, 0x00, //   #####  #####   
-	0x3E, 0x7C, 0x00, //   #####  #####   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6408 'y' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7E, 0x1F, 0x00, //  ######    ##### 
-	0x7E, 0x1F, 0x00, //  ######    ##### 
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x03, 0x60, 0x00, //       ## ##      
-	0x03, 0xE0, 0x00, //       #####      
-	0x01, 0xC0, 0x00, //        ###       
-	0x00, 0xC0, 0x00, //         ##       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x00, 0x00, //       ##         
-	0x3F, 0xC0, 0x00, //   ########       
-	0x3F, 0xC0, 0x00, //   ########       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6480 'z' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x18, 0x60, 0x00, //    ##    ##      
-	0x00, 0xC0, 0x00, //         ##       
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x00, 0x00, //       ##         
-	0x06, 0x18, 0x00, //      ##    ##    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6552 '{' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xE0, 0x00, //         ###      
-	0x01, 0xE0, 0x00, //        ####      
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x80, 0x00, //       ###        
-	0x07, 0x00, 0x00, //      ###         
-	0x03, 0x80, 0x00, //       ###        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0xE0, 0x00, //        ####      
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6624 '|' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6696 '}' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0x00, 0x00, //      ###         
-	0x07, 0x80, 0x00, //      ####        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0xC0, 0x00, //        ###       
-	0x00, 0xE0, 0x00, //         ###      
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x07, 0x80, 0x00, //      ####        
-	0x07, 0x00, 0x00, //      ###         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6768 '~' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x0E, 0x00, 0x00, //     ###          
-	0x1F, 0x18, 0x00, //    #####   ##    
-	0x3B, 0xB8, 0x00, //   ### ### ###    
-	0x31, 0xF0, 0x00, //   ##   #####     
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-};
-
-sFONT Font24 = {
-  Font24_Table,
-  17, /* Width */
-  24, /* Height */
-};
-
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+/**
+ * Font24 (17x24) as column spans, see tools/fontc/fontc.py
+ * Compiled from fonts/font24.cpp, do not edit.
+ */
+#include <stddef.h>
+#include "fonts.h"
+
+// 3673 bytes (bitmap table: 6840)
+const uint8_t Font24_Spans[] = {
+    // @0 ' '
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @17 '!'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x29, 0x42, 0x00, /* |..#########....##.......| */
+    0x2B, 0x22, 0x00, /* |..###########..##.......| */
+    0x29, 0x42, 0x00, /* |..#########....##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @40 '"'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x33, 0x00, /* |...###..................| */
+    0x37, 0x00, /* |...#######..............| */
+    0x33, 0x00, /* |...###..................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x33, 0x00, /* |...###..................| */
+    0x37, 0x00, /* |...#######..............| */
+    0x33, 0x00, /* |...###..................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @63 '#'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x18, 0x00, /* |.......##.########......| */
+    0xF0, 0x02, 0x10, 0x00, /* |..################......| */
+    0x28, 0x12, 0x00, /* |..########.##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x18, 0x00, /* |.......##.########......| */
+    0xF0, 0x02, 0x10, 0x00, /* |..################......| */
+    0x28, 0x12, 0x00, /* |..########.##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @104 '$'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x53, 0x35, 0x00, /* |.....###...#####........| */
+    0x45, 0x25, 0x00, /* |....#####..#####........| */
+    0x32, 0x23, 0x23, 0x00, /* |...##..###..###.........| */
+    0x32, 0x32, 0x42, 0x00, /* |...##...##....##........| */
+    0x14, 0x32, 0x46, 0x00, /* |.####...##....######....| */
+    0x14, 0x33, 0x36, 0x00, /* |.####...###...######....| */
+    0x43, 0x22, 0x23, 0x00, /* |....###..##..###........| */
+    0x34, 0x26, 0x00, /* |...####..######.........| */
+    0x34, 0x34, 0x00, /* |...####...####..........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @144 '%'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x44, 0x21, 0x00, /* |....####..#.............| */
+    0x36, 0x11, 0x00, /* |...######.#.............| */
+    0x23, 0x28, 0x00, /* |..###..########.........| */
+    0x22, 0x48, 0x00, /* |..##....########........| */
+    0x22, 0x44, 0x23, 0x00, /* |..##....####..###.......| */
+    0x23, 0x24, 0x42, 0x00, /* |..###..####....##.......| */
+    0x38, 0x42, 0x00, /* |...########....##.......| */
+    0x48, 0x23, 0x00, /* |....########..###.......| */
+    0x81, 0x16, 0x00, /* |........#.######........| */
+    0x81, 0x24, 0x00, /* |........#..####.........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @183 '&'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xC3, 0x00, /* |............###.........| */
+    0x63, 0x25, 0x00, /* |......###..#####........| */
+    0x58, 0x22, 0x00, /* |.....########..##.......| */
+    0x42, 0x33, 0x32, 0x00, /* |....##...###...##.......| */
+    0x42, 0x43, 0x22, 0x00, /* |....##....###..##.......| */
+    0x42, 0x53, 0x12, 0x00, /* |....##.....###.##.......| */
+    0x43, 0x55, 0x00, /* |....###.....#####.......| */
+    0x43, 0x54, 0x00, /* |....###.....####........| */
+    0x42, 0x56, 0x00, /* |....##.....######.......| */
+    0xB2, 0x22, 0x00, /* |...........##..##.......| */
+    0xB2, 0x22, 0x00, /* |...........##..##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @224 "'"
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x33, 0x00, /* |...###..................| */
+    0x37, 0x00, /* |...#######..............| */
+    0x33, 0x00, /* |...###..................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @244 '('
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x86, 0x00, /* |........######..........| */
+    0x5B, 0x00, /* |.....###########........| */
+    0x4E, 0x00, /* |....##############......| */
+    0x35, 0x65, 0x00, /* |...#####......#####.....| */
+    0x24, 0xA4, 0x00, /* |..####..........####....| */
+    0x22, 0xE2, 0x00, /* |..##..............##....| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @270 ')'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x22, 0xE2, 0x00, /* |..##..............##....| */
+    0x24, 0xA4, 0x00, /* |..####..........####....| */
+    0x35, 0x65, 0x00, /* |...#####......#####.....| */
+    0x4E, 0x00, /* |....##############......| */
+    0x6B, 0x00, /* |......###########.......| */
+    0x86, 0x00, /* |........######..........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @296 '*'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x52, 0x00, /* |.....##.................| */
+    0x52, 0x00, /* |.....##.................| */
+    0x53, 0x22, 0x00, /* |.....###..##............| */
+    0x66, 0x00, /* |......######............| */
+    0x28, 0x00, /* |..########..............| */
+    0x28, 0x00, /* |..########..............| */
+    0x66, 0x00, /* |......######............| */
+    0x53, 0x22, 0x00, /* |.....###..##............| */
+    0x52, 0x00, /* |.....##.................| */
+    0x52, 0x00, /* |.....##.................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @325 '+'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x4C, 0x00, /* |....############........| */
+    0x4C, 0x00, /* |....############........| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @354 ','
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xF0, 0x13, 0x02, 0x00, /* |...................##...| */
+    0xF0, 0x10, 0x05, 0x00, /* |................#####...| */
+    0xE5, 0x00, /* |..............#####.....| */
+    0xE3, 0x00, /* |..............###.......| */
+    0xE1, 0x00, /* |..............#.........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @380 '-'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @407 '.'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xE3, 0x00, /* |..............###.......| */
+    0xE3, 0x00, /* |..............###.......| */
+    0xE3, 0x00, /* |..............###.......| */
+    0xE3, 0x00, /* |..............###.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @428 '/'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xF0, 0x11, 0x03, 0x00, /* |.................###....| */
+    0xF5, 0x00, /* |...............#####....| */
+    0xD5, 0x00, /* |.............#####......| */
+    0xB5, 0x00, /* |...........#####........| */
+    0x94, 0x00, /* |.........####...........| */
+    0x74, 0x00, /* |.......####.............| */
+    0x45, 0x00, /* |....#####...............| */
+    0x25, 0x00, /* |..#####.................| */
+    0x05, 0x00, /* |#####...................| */
+    0x03, 0x00, /* |###.....................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @457 '0'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x67, 0x00, /* |......#######...........| */
+    0x4B, 0x00, /* |....###########.........| */
+    0x33, 0x73, 0x00, /* |...###.......###........| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x33, 0x73, 0x00, /* |...###.......###........| */
+    0x4B, 0x00, /* |....###########.........| */
+    0x67, 0x00, /* |......#######...........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @490 '1'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x42, 0x92, 0x00, /* |....##.........##.......| */
+    0x42, 0x92, 0x00, /* |....##.........##.......| */
+    0x33, 0x92, 0x00, /* |...###.........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x2F, 0x00, /* |..###############.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @521 '2'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x43, 0x82, 0x00, /* |....###........##.......| */
+    0x34, 0x73, 0x00, /* |...####.......###.......| */
+    0x32, 0x84, 0x00, /* |...##........####.......| */
+    0x22, 0x82, 0x12, 0x00, /* |..##........##.##.......| */
+    0x22, 0x72, 0x22, 0x00, /* |..##.......##..##.......| */
+    0x22, 0x62, 0x32, 0x00, /* |..##......##...##.......| */
+    0x22, 0x62, 0x32, 0x00, /* |..##......##...##.......| */
+    0x22, 0x52, 0x42, 0x00, /* |..##.....##....##.......| */
+    0x32, 0x32, 0x52, 0x00, /* |...##...##.....##.......| */
+    0x36, 0x62, 0x00, /* |...######......##.......| */
+    0x53, 0x72, 0x00, /* |.....###.......##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @566 '3'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xE2, 0x00, /* |..............##........| */
+    0x32, 0x93, 0x00, /* |...##.........###.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x22, 0x42, 0x52, 0x00, /* |..##....##.....##.......| */
+    0x22, 0x42, 0x52, 0x00, /* |..##....##.....##.......| */
+    0x22, 0x42, 0x52, 0x00, /* |..##....##.....##.......| */
+    0x23, 0x24, 0x42, 0x00, /* |..###..####....##.......| */
+    0x35, 0x12, 0x32, 0x00, /* |...#####.##...##........| */
+    0x43, 0x36, 0x00, /* |....###...######........| */
+    0xB4, 0x00, /* |...........####.........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @606 '4'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xB3, 0x00, /* |...........###..........| */
+    0xA4, 0x00, /* |..........####..........| */
+    0x83, 0x12, 0x00, /* |........###.##..........| */
+    0x64, 0x22, 0x00, /* |......####..##..........| */
+    0x53, 0x42, 0x12, 0x00, /* |.....###....##.##.......| */
+    0x33, 0x62, 0x12, 0x00, /* |...###......##.##.......| */
+    0x23, 0x72, 0x12, 0x00, /* |..###.......##.##.......| */
+    0x2F, 0x00, /* |..###############.......| */
+    0x2F, 0x00, /* |..###############.......| */
+    0xC2, 0x12, 0x00, /* |............##.##.......| */
+    0xC2, 0x12, 0x00, /* |............##.##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @644 '5'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xE2, 0x00, /* |..............##........| */
+    0x28, 0x42, 0x00, /* |..########....##........| */
+    0x28, 0x52, 0x00, /* |..########.....##.......| */
+    0x22, 0x42, 0x52, 0x00, /* |..##....##.....##.......| */
+    0x22, 0x32, 0x62, 0x00, /* |..##...##......##.......| */
+    0x22, 0x32, 0x62, 0x00, /* |..##...##......##.......| */
+    0x22, 0x32, 0x62, 0x00, /* |..##...##......##.......| */
+    0x22, 0x32, 0x62, 0x00, /* |..##...##......##.......| */
+    0x22, 0x42, 0x42, 0x00, /* |..##....##....##........| */
+    0x22, 0x48, 0x00, /* |..##....########........| */
+    0xA4, 0x00, /* |..........####..........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @687 '6'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x77, 0x00, /* |.......#######..........| */
+    0x5B, 0x00, /* |.....###########........| */
+    0x43, 0x22, 0x32, 0x00, /* |....###..##...##........| */
+    0x33, 0x22, 0x52, 0x00, /* |...###..##.....##.......| */
+    0x32, 0x32, 0x52, 0x00, /* |...##...##.....##.......| */
+    0x22, 0x42, 0x52, 0x00, /* |..##....##.....##.......| */
+    0x22, 0x42, 0x52, 0x00, /* |..##....##.....##.......| */
+    0x22, 0x52, 0x33, 0x00, /* |..##.....##...###.......| */
+    0x22, 0x57, 0x00, /* |..##.....#######........| */
+    0x22, 0x74, 0x00, /* |..##.......####.........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @728 '7'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x24, 0x00, /* |..####..................| */
+    0x24, 0x00, /* |..####..................| */
+    0x22, 0x00, /* |..##....................| */
+    0x22, 0x00, /* |..##....................| */
+    0x22, 0xA3, 0x00, /* |..##..........###.......| */
+    0x22, 0x76, 0x00, /* |..##.......######.......| */
+    0x22, 0x47, 0x00, /* |..##....#######.........| */
+    0x22, 0x17, 0x00, /* |..##.#######............| */
+    0x27, 0x00, /* |..#######...............| */
+    0x24, 0x00, /* |..####..................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @759 '8'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x43, 0x44, 0x00, /* |....###....####.........| */
+    0x35, 0x26, 0x00, /* |...#####..######........| */
+    0x23, 0x24, 0x33, 0x00, /* |..###..####...###.......| */
+    0x22, 0x42, 0x52, 0x00, /* |..##....##.....##.......| */
+    0x22, 0x42, 0x52, 0x00, /* |..##....##.....##.......| */
+    0x22, 0x42, 0x52, 0x00, /* |..##....##.....##.......| */
+    0x22, 0x42, 0x52, 0x00, /* |..##....##.....##.......| */
+    0x23, 0x24, 0x33, 0x00, /* |..###..####...###.......| */
+    0x35, 0x26, 0x00, /* |...#####..######........| */
+    0x43, 0x44, 0x00, /* |....###....####.........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @802 '9'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x44, 0x72, 0x00, /* |....####.......##.......| */
+    0x37, 0x52, 0x00, /* |...#######.....##.......| */
+    0x23, 0x32, 0x52, 0x00, /* |..###...##.....##.......| */
+    0x22, 0x52, 0x42, 0x00, /* |..##.....##....##.......| */
+    0x22, 0x52, 0x42, 0x00, /* |..##.....##....##.......| */
+    0x22, 0x52, 0x32, 0x00, /* |..##.....##...##........| */
+    0x22, 0x52, 0x23, 0x00, /* |..##.....##..###........| */
+    0x32, 0x32, 0x23, 0x00, /* |...##...##..###.........| */
+    0x3B, 0x00, /* |...###########..........| */
+    0x57, 0x00, /* |.....#######............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @843 ':'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x63, 0x53, 0x00, /* |......###.....###.......| */
+    0x63, 0x53, 0x00, /* |......###.....###.......| */
+    0x63, 0x53, 0x00, /* |......###.....###.......| */
+    0x63, 0x53, 0x00, /* |......###.....###.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @868 ';'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xF0, 0x11, 0x02, 0x00, /* |.................##.....| */
+    0xE4, 0x00, /* |..............####......| */
+    0x63, 0x44, 0x00, /* |......###....####.......| */
+    0x63, 0x42, 0x00, /* |......###....##.........| */
+    0x63, 0x41, 0x00, /* |......###....#..........| */
+    0x63, 0x00, /* |......###...............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @896 '<'
+    0xA1, 0x00, /* |..........#.............| */
+    0xA1, 0x00, /* |..........#.............| */
+    0x93, 0x00, /* |.........###............| */
+    0x93, 0x00, /* |.........###............| */
+    0x82, 0x12, 0x00, /* |........##.##...........| */
+    0x82, 0x12, 0x00, /* |........##.##...........| */
+    0x72, 0x32, 0x00, /* |.......##...##..........| */
+    0x72, 0x32, 0x00, /* |.......##...##..........| */
+    0x62, 0x52, 0x00, /* |......##.....##.........| */
+    0x62, 0x52, 0x00, /* |......##.....##.........| */
+    0x52, 0x72, 0x00, /* |.....##.......##........| */
+    0x43, 0x73, 0x00, /* |....###.......###.......| */
+    0x42, 0x92, 0x00, /* |....##.........##.......| */
+    0x42, 0x92, 0x00, /* |....##.........##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @937 '='
+    0x00, /* |........................| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x72, 0x22, 0x00, /* |.......##..##...........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @980 '>'
+    0x00, /* |........................| */
+    0x42, 0x92, 0x00, /* |....##.........##.......| */
+    0x42, 0x92, 0x00, /* |....##.........##.......| */
+    0x43, 0x73, 0x00, /* |....###.......###.......| */
+    0x52, 0x72, 0x00, /* |.....##.......##........| */
+    0x62, 0x52, 0x00, /* |......##.....##.........| */
+    0x62, 0x52, 0x00, /* |......##.....##.........| */
+    0x72, 0x32, 0x00, /* |.......##...##..........| */
+    0x72, 0x32, 0x00, /* |.......##...##..........| */
+    0x82, 0x12, 0x00, /* |........##.##...........| */
+    0x82, 0x12, 0x00, /* |........##.##...........| */
+    0x93, 0x00, /* |.........###............| */
+    0x93, 0x00, /* |.........###............| */
+    0xA1, 0x00, /* |..........#.............| */
+    0xA1, 0x00, /* |..........#.............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1021 '?'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x53, 0x00, /* |.....###................| */
+    0x44, 0x00, /* |....####................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0x53, 0x22, 0x00, /* |...##.....###..##.......| */
+    0x32, 0x53, 0x22, 0x00, /* |...##.....###..##.......| */
+    0x32, 0x43, 0x00, /* |...##....###............| */
+    0x33, 0x23, 0x00, /* |...###..###.............| */
+    0x46, 0x00, /* |....######..............| */
+    0x54, 0x00, /* |.....####...............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1054 '@'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x69, 0x00, /* |......#########.........| */
+    0x4D, 0x00, /* |....#############.......| */
+    0x33, 0x93, 0x00, /* |...###.........###......| */
+    0x23, 0xB3, 0x00, /* |..###...........###.....| */
+    0x22, 0x44, 0x52, 0x00, /* |..##....####.....##.....| */
+    0x22, 0x36, 0x42, 0x00, /* |..##...######....##.....| */
+    0x22, 0x23, 0x32, 0x32, 0x00, /* |..##..###...##...##.....| */
+    0x23, 0x12, 0x42, 0x32, 0x00, /* |..###.##....##...##.....| */
+    0x3B, 0x22, 0x00, /* |...###########..##......| */
+    0x4A, 0x22, 0x00, /* |....##########..##......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1095 'A'
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xE3, 0x00, /* |..............###.......| */
+    0x32, 0x75, 0x00, /* |...##.......#####.......| */
+    0x32, 0x54, 0x12, 0x00, /* |...##.....####.##.......| */
+    0x32, 0x35, 0x22, 0x00, /* |...##...#####..##.......| */
+    0x32, 0x14, 0x12, 0x00, /* |...##.####.##...........| */
+    0x35, 0x32, 0x00, /* |...#####...##...........| */
+    0x33, 0x52, 0x00, /* |...###.....##...........| */
+    0x44, 0x32, 0x22, 0x00, /* |....####...##..##.......| */
+    0x67, 0x22, 0x00, /* |......#######..##.......| */
+    0x85, 0x22, 0x00, /* |........#####..##.......| */
+    0xB6, 0x00, /* |...........######.......| */
+    0xD4, 0x00, /* |.............####.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    // @1141 'B'
+    0x00, /* |........................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x33, 0x23, 0x42, 0x00, /* |...###..###....##.......| */
+    0x48, 0x32, 0x00, /* |....########...##.......| */
+    0x54, 0x16, 0x00, /* |.....####.######........| */
+    0xB4, 0x00, /* |...........####.........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1187 'C'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x76, 0x00, /* |.......######...........| */
+    0x5A, 0x00, /* |.....##########.........| */
+    0x43, 0x63, 0x00, /* |....###......###........| */
+    0x42, 0x82, 0x00, /* |....##........##........| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x42, 0x83, 0x00, /* |....##........###.......| */
+    0x35, 0x53, 0x00, /* |...#####.....###........| */
+    0x35, 0x52, 0x00, /* |...#####.....##.........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1226 'D'
+    0x00, /* |........................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x42, 0x83, 0x00, /* |....##........###.......| */
+    0x43, 0x63, 0x00, /* |....###......###........| */
+    0x5A, 0x00, /* |.....##########.........| */
+    0x76, 0x00, /* |.......######...........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1265 'E'
+    0x00, /* |........................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x26, 0x22, 0x00, /* |...##..######..##.......| */
+    0x32, 0x26, 0x22, 0x00, /* |...##..######..##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x35, 0x45, 0x00, /* |...#####....#####.......| */
+    0x35, 0x45, 0x00, /* |...#####....#####.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1308 'F'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x26, 0x22, 0x00, /* |...##..######..##.......| */
+    0x32, 0x26, 0x22, 0x00, /* |...##..######..##.......| */
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    0x35, 0x00, /* |...#####................| */
+    0x35, 0x00, /* |...#####................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1347 'G'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x77, 0x00, /* |.......#######..........| */
+    0x5A, 0x00, /* |.....##########.........| */
+    0x43, 0x63, 0x00, /* |....###......###........| */
+    0x42, 0x82, 0x00, /* |....##........##........| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0x52, 0x32, 0x00, /* |...##.....##...##.......| */
+    0x32, 0x52, 0x32, 0x00, /* |...##.....##...##.......| */
+    0x32, 0x52, 0x32, 0x00, /* |...##.....##...##.......| */
+    0x42, 0x42, 0x23, 0x00, /* |....##....##..###.......| */
+    0x35, 0x26, 0x00, /* |...#####..######........| */
+    0x35, 0x26, 0x00, /* |...#####..######........| */
+    0xA2, 0x00, /* |..........##............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1391 'H'
+    0x00, /* |........................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x92, 0x00, /* |.........##.............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1434 'I'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1469 'J'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xA6, 0x00, /* |..........######........| */
+    0xA6, 0x00, /* |..........######........| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0x92, 0x00, /* |...##.........##........| */
+    0x3D, 0x00, /* |...#############........| */
+    0x3B, 0x00, /* |...###########..........| */
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1504 'K'
+    0x00, /* |........................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0x52, 0x32, 0x00, /* |...##.....##...##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x33, 0x42, 0x00, /* |...##...###....##.......| */
+    0x75, 0x00, /* |.......#####............| */
+    0x62, 0x23, 0x00, /* |......##..###...........| */
+    0x34, 0x44, 0x00, /* |...####....####.........| */
+    0x33, 0x65, 0x00, /* |...###......#####.......| */
+    0x32, 0x93, 0x00, /* |...##.........###.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    // @1550 'L'
+    0x00, /* |........................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xB6, 0x00, /* |...........######.......| */
+    0xB6, 0x00, /* |...........######.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1586 'M'
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x44, 0x72, 0x00, /* |....####.......##.......| */
+    0x64, 0x52, 0x00, /* |......####.....##.......| */
+    0x84, 0x32, 0x00, /* |........####...##.......| */
+    0xA3, 0x00, /* |..........###...........| */
+    0xA3, 0x00, /* |..........###...........| */
+    0x84, 0x32, 0x00, /* |........####...##.......| */
+    0x64, 0x52, 0x00, /* |......####.....##.......| */
+    0x44, 0x72, 0x00, /* |....####.......##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x00, /* |........................| */
+    // @1629 'N'
+    0x00, /* |........................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x53, 0x72, 0x00, /* |.....###.......##.......| */
+    0x64, 0x52, 0x00, /* |......####.....##.......| */
+    0x74, 0x42, 0x00, /* |.......####....##.......| */
+    0x32, 0x44, 0x00, /* |...##....####...........| */
+    0x32, 0x54, 0x00, /* |...##.....####..........| */
+    0x32, 0x73, 0x00, /* |...##.......###.........| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1668 'O'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x76, 0x00, /* |.......######...........| */
+    0x5A, 0x00, /* |.....##########.........| */
+    0x44, 0x44, 0x00, /* |....####....####........| */
+    0x42, 0x82, 0x00, /* |....##........##........| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x42, 0x82, 0x00, /* |....##........##........| */
+    0x44, 0x44, 0x00, /* |....####....####........| */
+    0x5A, 0x00, /* |.....##########.........| */
+    0x76, 0x00, /* |.......######...........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1705 'P'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0x52, 0x32, 0x00, /* |...##.....##...##.......| */
+    0x32, 0x52, 0x32, 0x00, /* |...##.....##...##.......| */
+    0x32, 0x52, 0x32, 0x00, /* |...##.....##...##.......| */
+    0x32, 0x52, 0x32, 0x00, /* |...##.....##...##.......| */
+    0x32, 0x52, 0x00, /* |...##.....##............| */
+    0x33, 0x32, 0x00, /* |...###...##.............| */
+    0x47, 0x00, /* |....#######.............| */
+    0x54, 0x00, /* |.....####...............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1746 'Q'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x76, 0x00, /* |.......######...........| */
+    0x5A, 0x00, /* |.....##########.........| */
+    0x44, 0x44, 0x22, 0x00, /* |....####....####..##....| */
+    0x42, 0x86, 0x00, /* |....##........######....| */
+    0x32, 0xA4, 0x00, /* |...##..........####.....| */
+    0x32, 0xA4, 0x00, /* |...##..........####.....| */
+    0x32, 0xA4, 0x00, /* |...##..........####.....| */
+    0x32, 0xA4, 0x00, /* |...##..........####.....| */
+    0x42, 0x82, 0x22, 0x00, /* |....##........##..##....| */
+    0x44, 0x44, 0x22, 0x00, /* |....####....####..##....| */
+    0x5A, 0x23, 0x00, /* |.....##########..###....| */
+    0x76, 0x42, 0x00, /* |.......######....##.....| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1788 'R'
+    0x00, /* |........................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x43, 0x00, /* |...##....###............| */
+    0x32, 0x44, 0x00, /* |...##....####...........| */
+    0x33, 0x22, 0x14, 0x00, /* |...###..##.####.........| */
+    0x46, 0x24, 0x00, /* |....######..####........| */
+    0x54, 0x53, 0x00, /* |.....####.....###.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1833 'S'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x54, 0x35, 0x00, /* |.....####...#####.......| */
+    0x46, 0x25, 0x00, /* |....######..#####.......| */
+    0x33, 0x22, 0x42, 0x00, /* |...###..##....##........| */
+    0x32, 0x33, 0x42, 0x00, /* |...##...###....##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x43, 0x32, 0x00, /* |...##....###...##.......| */
+    0x42, 0x42, 0x23, 0x00, /* |....##....##..###.......| */
+    0x35, 0x26, 0x00, /* |...#####..######........| */
+    0x35, 0x34, 0x00, /* |...#####...####.........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1876 'T'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x36, 0x00, /* |...######...............| */
+    0x36, 0x00, /* |...######...............| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x36, 0x00, /* |...######...............| */
+    0x36, 0x00, /* |...######...............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1911 'U'
+    0x00, /* |........................| */
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    0x3B, 0x00, /* |...###########..........| */
+    0x3D, 0x00, /* |...#############........| */
+    0x32, 0x92, 0x00, /* |...##.........##........| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0x92, 0x00, /* |...##.........##........| */
+    0x3D, 0x00, /* |...#############........| */
+    0x3B, 0x00, /* |...###########..........| */
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @1946 'V'
+    0x00, /* |........................| */
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    0x33, 0x00, /* |...###..................| */
+    0x36, 0x00, /* |...######...............| */
+    0x32, 0x15, 0x00, /* |...##.#####.............| */
+    0x32, 0x45, 0x00, /* |...##....#####..........| */
+    0x32, 0x65, 0x00, /* |...##......#####........| */
+    0xE3, 0x00, /* |..............###.......| */
+    0x32, 0x65, 0x00, /* |...##......#####........| */
+    0x32, 0x45, 0x00, /* |...##....#####..........| */
+    0x32, 0x15, 0x00, /* |...##.#####.............| */
+    0x36, 0x00, /* |...######...............| */
+    0x33, 0x00, /* |...###..................| */
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    0x00, /* |........................| */
+    // @1984 'W'
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    0x35, 0x00, /* |...#####................| */
+    0x3A, 0x00, /* |...##########...........| */
+    0x32, 0x39, 0x00, /* |...##...#########.......| */
+    0x32, 0x75, 0x00, /* |...##.......#####.......| */
+    0x32, 0x55, 0x00, /* |...##.....#####.........| */
+    0x84, 0x00, /* |........####............| */
+    0x73, 0x00, /* |.......###..............| */
+    0x85, 0x00, /* |........#####...........| */
+    0x32, 0x55, 0x00, /* |...##.....#####.........| */
+    0x32, 0x75, 0x00, /* |...##.......#####.......| */
+    0x32, 0x39, 0x00, /* |...##...#########.......| */
+    0x3A, 0x00, /* |...##########...........| */
+    0x35, 0x00, /* |...#####................| */
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    // @2024 'X'
+    0x00, /* |........................| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x33, 0x83, 0x00, /* |...###........###.......| */
+    0x34, 0x64, 0x00, /* |...####......####.......| */
+    0x32, 0x12, 0x42, 0x12, 0x00, /* |...##.##....##.##.......| */
+    0x32, 0x22, 0x22, 0x22, 0x00, /* |...##..##..##..##.......| */
+    0x84, 0x00, /* |........####............| */
+    0x84, 0x00, /* |........####............| */
+    0x32, 0x22, 0x22, 0x22, 0x00, /* |...##..##..##..##.......| */
+    0x32, 0x12, 0x42, 0x12, 0x00, /* |...##.##....##.##.......| */
+    0x34, 0x64, 0x00, /* |...####......####.......| */
+    0x33, 0x83, 0x00, /* |...###........###.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x32, 0xA2, 0x00, /* |...##..........##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2075 'Y'
+    0x00, /* |........................| */
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    0x33, 0x00, /* |...###..................| */
+    0x34, 0x82, 0x00, /* |...####........##.......| */
+    0x32, 0x13, 0x62, 0x00, /* |...##.###......##.......| */
+    0x73, 0x52, 0x00, /* |.......###.....##.......| */
+    0x98, 0x00, /* |.........########.......| */
+    0x98, 0x00, /* |.........########.......| */
+    0x32, 0x23, 0x52, 0x00, /* |...##..###.....##.......| */
+    0x32, 0x13, 0x62, 0x00, /* |...##.###......##.......| */
+    0x34, 0x82, 0x00, /* |...####........##.......| */
+    0x33, 0x00, /* |...###..................| */
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2115 'Z'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xE3, 0x00, /* |..............###.......| */
+    0x36, 0x44, 0x00, /* |...######....####.......| */
+    0x36, 0x32, 0x12, 0x00, /* |...######...##.##.......| */
+    0x32, 0x62, 0x22, 0x00, /* |...##......##..##.......| */
+    0x32, 0x52, 0x32, 0x00, /* |...##.....##...##.......| */
+    0x32, 0x42, 0x42, 0x00, /* |...##....##....##.......| */
+    0x32, 0x32, 0x52, 0x00, /* |...##...##.....##.......| */
+    0x32, 0x22, 0x62, 0x00, /* |...##..##......##.......| */
+    0x32, 0x12, 0x72, 0x00, /* |...##.##.......##.......| */
+    0x34, 0x46, 0x00, /* |...####....######.......| */
+    0x33, 0x56, 0x00, /* |...###.....######.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2160 '['
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xF0, 0x02, 0x12, 0x00, /* |..##################....| */
+    0xF0, 0x02, 0x12, 0x00, /* |..##################....| */
+    0x22, 0xE2, 0x00, /* |..##..............##....| */
+    0x22, 0xE2, 0x00, /* |..##..............##....| */
+    0x22, 0xE2, 0x00, /* |..##..............##....| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2189 '\\'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x03, 0x00, /* |###.....................| */
+    0x05, 0x00, /* |#####...................| */
+    0x25, 0x00, /* |..#####.................| */
+    0x45, 0x00, /* |....#####...............| */
+    0x74, 0x00, /* |.......####.............| */
+    0x94, 0x00, /* |.........####...........| */
+    0xB5, 0x00, /* |...........#####........| */
+    0xD5, 0x00, /* |.............#####......| */
+    0xF5, 0x00, /* |...............#####....| */
+    0xF0, 0x11, 0x03, 0x00, /* |.................###....| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2218 ']'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x22, 0xE2, 0x00, /* |..##..............##....| */
+    0x22, 0xE2, 0x00, /* |..##..............##....| */
+    0x22, 0xE2, 0x00, /* |..##..............##....| */
+    0xF0, 0x02, 0x12, 0x00, /* |..##################....| */
+    0xF0, 0x02, 0x12, 0x00, /* |..##################....| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2247 '^'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x72, 0x00, /* |.......##...............| */
+    0x62, 0x00, /* |......##................| */
+    0x43, 0x00, /* |....###.................| */
+    0x33, 0x00, /* |...###..................| */
+    0x23, 0x00, /* |..###...................| */
+    0x13, 0x00, /* |.###....................| */
+    0x23, 0x00, /* |..###...................| */
+    0x33, 0x00, /* |...###..................| */
+    0x43, 0x00, /* |....###.................| */
+    0x62, 0x00, /* |......##................| */
+    0x72, 0x00, /* |.......##...............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2275 '_'
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0xF0, 0x16, 0x02, 0x00, /* |......................##| */
+    0x00, /* |........................| */
+    // @2340 '`'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x12, 0x00, /* |.##.....................| */
+    0x12, 0x00, /* |.##.....................| */
+    0x22, 0x00, /* |..##....................| */
+    0x32, 0x00, /* |...##...................| */
+    0x32, 0x00, /* |...##...................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2362 'a'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xC3, 0x00, /* |............###.........| */
+    0x71, 0x35, 0x00, /* |.......#...#####........| */
+    0x62, 0x32, 0x22, 0x00, /* |......##...##..##.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x22, 0x22, 0x00, /* |......##..##..##........| */
+    0x7A, 0x00, /* |.......##########.......| */
+    0x89, 0x00, /* |........#########.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2404 'b'
+    0x00, /* |........................| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x2F, 0x00, /* |..###############.......| */
+    0x2F, 0x00, /* |..###############.......| */
+    0x72, 0x52, 0x00, /* |.......##.....##........| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x72, 0x52, 0x00, /* |.......##.....##........| */
+    0x79, 0x00, /* |.......#########........| */
+    0x95, 0x00, /* |.........#####..........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2443 'c'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x95, 0x00, /* |.........#####..........| */
+    0x87, 0x00, /* |........#######.........| */
+    0x73, 0x33, 0x00, /* |.......###...###........| */
+    0x72, 0x52, 0x00, /* |.......##.....##........| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x72, 0x53, 0x00, /* |.......##.....###.......| */
+    0x65, 0x23, 0x00, /* |......#####..###........| */
+    0x65, 0x22, 0x00, /* |......#####..##.........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2482 'd'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x95, 0x00, /* |.........#####..........| */
+    0x79, 0x00, /* |.......#########........| */
+    0x72, 0x52, 0x00, /* |.......##.....##........| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x22, 0x22, 0x72, 0x00, /* |..##..##.......##.......| */
+    0x22, 0x32, 0x52, 0x00, /* |..##...##.....##........| */
+    0x2F, 0x00, /* |..###############.......| */
+    0x2F, 0x00, /* |..###############.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2521 'e'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x95, 0x00, /* |.........#####..........| */
+    0x79, 0x00, /* |.......#########........| */
+    0x72, 0x12, 0x22, 0x00, /* |.......##.##..##........| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x72, 0x12, 0x32, 0x00, /* |.......##.##...##.......| */
+    0x75, 0x22, 0x00, /* |.......#####..##........| */
+    0x93, 0x22, 0x00, /* |.........###..##........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2568 'f'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x4D, 0x00, /* |....#############.......| */
+    0x3E, 0x00, /* |...##############.......| */
+    0x22, 0x22, 0x72, 0x00, /* |..##..##.......##.......| */
+    0x22, 0x22, 0x72, 0x00, /* |..##..##.......##.......| */
+    0x22, 0x22, 0x72, 0x00, /* |..##..##.......##.......| */
+    0x22, 0x22, 0x72, 0x00, /* |..##..##.......##.......| */
+    0x22, 0x22, 0x72, 0x00, /* |..##..##.......##.......| */
+    0x22, 0x22, 0x00, /* |..##..##................| */
+    0x22, 0x00, /* |..##....................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2611 'g'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x95, 0x00, /* |.........#####..........| */
+    0x79, 0x00, /* |.......#########........| */
+    0x72, 0x52, 0x42, 0x00, /* |.......##.....##....##..| */
+    0x62, 0x72, 0x32, 0x00, /* |......##.......##...##..| */
+    0x62, 0x72, 0x32, 0x00, /* |......##.......##...##..| */
+    0x62, 0x72, 0x32, 0x00, /* |......##.......##...##..| */
+    0x62, 0x72, 0x32, 0x00, /* |......##.......##...##..| */
+    0x62, 0x72, 0x32, 0x00, /* |......##.......##...##..| */
+    0x72, 0x52, 0x32, 0x00, /* |.......##.....##...##...| */
+    0x6F, 0x00, /* |......###############...| */
+    0x6E, 0x00, /* |......##############....| */
+    0x62, 0x00, /* |......##................| */
+    0x62, 0x00, /* |......##................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2655 'h'
+    0x00, /* |........................| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x2F, 0x00, /* |..###############.......| */
+    0x2F, 0x00, /* |..###############.......| */
+    0x72, 0x62, 0x00, /* |.......##......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x00, /* |......##................| */
+    0x62, 0x00, /* |......##................| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x63, 0x62, 0x00, /* |......###......##.......| */
+    0x7A, 0x00, /* |.......##########.......| */
+    0x89, 0x00, /* |........#########.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2692 'i'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x22, 0x2B, 0x00, /* |..##..###########.......| */
+    0x22, 0x2B, 0x00, /* |..##..###########.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2727 'j'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x62, 0xC2, 0x00, /* |......##............##..| */
+    0x62, 0xC2, 0x00, /* |......##............##..| */
+    0x62, 0xC2, 0x00, /* |......##............##..| */
+    0x62, 0xC2, 0x00, /* |......##............##..| */
+    0x62, 0xC2, 0x00, /* |......##............##..| */
+    0x22, 0x22, 0xC2, 0x00, /* |..##..##............##..| */
+    0x22, 0x22, 0xB2, 0x00, /* |..##..##...........##...| */
+    0x6F, 0x00, /* |......###############...| */
+    0x6E, 0x00, /* |......##############....| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2762 'k'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x2F, 0x00, /* |..###############.......| */
+    0x2F, 0x00, /* |..###############.......| */
+    0xA3, 0x00, /* |..........###...........| */
+    0x95, 0x00, /* |.........#####..........| */
+    0x65, 0x13, 0x00, /* |......#####.###.........| */
+    0x63, 0x44, 0x00, /* |......###....####.......| */
+    0x62, 0x63, 0x00, /* |......##......###.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2798 'l'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x22, 0xB2, 0x00, /* |..##...........##.......| */
+    0x2F, 0x00, /* |..###############.......| */
+    0x2F, 0x00, /* |..###############.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2831 'm'
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x6B, 0x00, /* |......###########.......| */
+    0x6B, 0x00, /* |......###########.......| */
+    0x72, 0x62, 0x00, /* |.......##......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x00, /* |......##................| */
+    0x6B, 0x00, /* |......###########.......| */
+    0x7A, 0x00, /* |.......##########.......| */
+    0x63, 0x62, 0x00, /* |......###......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x00, /* |......##................| */
+    0x6B, 0x00, /* |......###########.......| */
+    0x7A, 0x00, /* |.......##########.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    // @2870 'n'
+    0x00, /* |........................| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x6B, 0x00, /* |......###########.......| */
+    0x6B, 0x00, /* |......###########.......| */
+    0x72, 0x62, 0x00, /* |.......##......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x00, /* |......##................| */
+    0x62, 0x00, /* |......##................| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x63, 0x62, 0x00, /* |......###......##.......| */
+    0x7A, 0x00, /* |.......##########.......| */
+    0x89, 0x00, /* |........#########.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2907 'o'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x95, 0x00, /* |.........#####..........| */
+    0x87, 0x00, /* |........#######.........| */
+    0x73, 0x33, 0x00, /* |.......###...###........| */
+    0x72, 0x52, 0x00, /* |.......##.....##........| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x72, 0x52, 0x00, /* |.......##.....##........| */
+    0x73, 0x33, 0x00, /* |.......###...###........| */
+    0x87, 0x00, /* |........#######.........| */
+    0x95, 0x00, /* |.........#####..........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2944 'p'
+    0x00, /* |........................| */
+    0x62, 0xC2, 0x00, /* |......##............##..| */
+    0x62, 0xC2, 0x00, /* |......##............##..| */
+    0xF0, 0x06, 0x10, 0x00, /* |......################..| */
+    0xF0, 0x06, 0x10, 0x00, /* |......################..| */
+    0x72, 0x52, 0x42, 0x00, /* |.......##.....##....##..| */
+    0x62, 0x72, 0x32, 0x00, /* |......##.......##...##..| */
+    0x62, 0x72, 0x32, 0x00, /* |......##.......##...##..| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x72, 0x52, 0x00, /* |.......##.....##........| */
+    0x79, 0x00, /* |.......#########........| */
+    0x95, 0x00, /* |.........#####..........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @2990 'q'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x95, 0x00, /* |.........#####..........| */
+    0x79, 0x00, /* |.......#########........| */
+    0x72, 0x52, 0x00, /* |.......##.....##........| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x32, 0x00, /* |......##.......##...##..| */
+    0x62, 0x72, 0x32, 0x00, /* |......##.......##...##..| */
+    0x72, 0x52, 0x42, 0x00, /* |.......##.....##....##..| */
+    0xF0, 0x06, 0x10, 0x00, /* |......################..| */
+    0xF0, 0x06, 0x10, 0x00, /* |......################..| */
+    0x62, 0xC2, 0x00, /* |......##............##..| */
+    0x62, 0xC2, 0x00, /* |......##............##..| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @3036 'r'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x6B, 0x00, /* |......###########.......| */
+    0x6B, 0x00, /* |......###########.......| */
+    0x82, 0x52, 0x00, /* |........##.....##.......| */
+    0x72, 0x62, 0x00, /* |.......##......##.......| */
+    0x63, 0x62, 0x00, /* |......###......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x63, 0x00, /* |......###...............| */
+    0x72, 0x00, /* |.......##...............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @3073 's'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x83, 0x24, 0x00, /* |........###..####.......| */
+    0x75, 0x14, 0x00, /* |.......#####.####.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x23, 0x22, 0x00, /* |......##..###..##.......| */
+    0x62, 0x32, 0x22, 0x00, /* |......##...##..##.......| */
+    0x62, 0x32, 0x13, 0x00, /* |......##...##.###.......| */
+    0x64, 0x15, 0x00, /* |......####.#####........| */
+    0x64, 0x23, 0x00, /* |......####..###.........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @3116 't'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x62, 0x00, /* |......##................| */
+    0x62, 0x00, /* |......##................| */
+    0x2D, 0x00, /* |..#############.........| */
+    0x2E, 0x00, /* |..##############........| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x63, 0x00, /* |......##......###.......| */
+    0xE2, 0x00, /* |..............##........| */
+    0xE2, 0x00, /* |..............##........| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @3151 'u'
+    0x00, /* |........................| */
+    0x62, 0x00, /* |......##................| */
+    0x62, 0x00, /* |......##................| */
+    0x69, 0x00, /* |......#########.........| */
+    0x6A, 0x00, /* |......##########........| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x62, 0x00, /* |......##......##........| */
+    0x6B, 0x00, /* |......###########.......| */
+    0x6B, 0x00, /* |......###########.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0xF2, 0x00, /* |...............##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @3184 'v'
+    0x00, /* |........................| */
+    0x62, 0x00, /* |......##................| */
+    0x62, 0x00, /* |......##................| */
+    0x64, 0x00, /* |......####..............| */
+    0x66, 0x00, /* |......######............| */
+    0x62, 0x25, 0x00, /* |......##..#####.........| */
+    0xC5, 0x00, /* |............#####.......| */
+    0xE3, 0x00, /* |..............###.......| */
+    0xE3, 0x00, /* |..............###.......| */
+    0xC5, 0x00, /* |............#####.......| */
+    0x62, 0x25, 0x00, /* |......##..#####.........| */
+    0x66, 0x00, /* |......######............| */
+    0x64, 0x00, /* |......####..............| */
+    0x62, 0x00, /* |......##................| */
+    0x62, 0x00, /* |......##................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @3217 'w'
+    0x00, /* |........................| */
+    0x62, 0x00, /* |......##................| */
+    0x65, 0x00, /* |......#####.............| */
+    0x69, 0x00, /* |......#########.........| */
+    0x62, 0x36, 0x00, /* |......##...######.......| */
+    0xC5, 0x00, /* |............#####.......| */
+    0x95, 0x00, /* |.........#####..........| */
+    0x83, 0x00, /* |........###.............| */
+    0x95, 0x00, /* |.........#####..........| */
+    0xC5, 0x00, /* |............#####.......| */
+    0x62, 0x36, 0x00, /* |......##...######.......| */
+    0x68, 0x00, /* |......########..........| */
+    0x65, 0x00, /* |......#####.............| */
+    0x62, 0x00, /* |......##................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @3249 'x'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x63, 0x53, 0x00, /* |......###.....###.......| */
+    0x64, 0x34, 0x00, /* |......####...####.......| */
+    0x62, 0x12, 0x12, 0x12, 0x00, /* |......##.##.##.##.......| */
+    0xA3, 0x00, /* |..........###...........| */
+    0xA3, 0x00, /* |..........###...........| */
+    0x62, 0x12, 0x12, 0x12, 0x00, /* |......##.##.##.##.......| */
+    0x64, 0x34, 0x00, /* |......####...####.......| */
+    0x63, 0x53, 0x00, /* |......###.....###.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x62, 0x72, 0x00, /* |......##.......##.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @3292 'y'
+    0x00, /* |........................| */
+    0x62, 0x00, /* |......##................| */
+    0x62, 0xC2, 0x00, /* |......##............##..| */
+    0x63, 0xB2, 0x00, /* |......###...........##..| */
+    0x65, 0x92, 0x00, /* |......#####.........##..| */
+    0x62, 0x14, 0x72, 0x00, /* |......##.####.......##..| */
+    0x62, 0x34, 0x43, 0x00, /* |......##...####....###..| */
+    0xD3, 0x15, 0x00, /* |.............###.#####..| */
+    0xE5, 0x12, 0x00, /* |..............#####.##..| */
+    0xD4, 0x32, 0x00, /* |.............####...##..| */
+    0xB4, 0x00, /* |...........####.........| */
+    0x62, 0x14, 0x00, /* |......##.####...........| */
+    0x65, 0x00, /* |......#####.............| */
+    0x63, 0x00, /* |......###...............| */
+    0x62, 0x00, /* |......##................| */
+    0x62, 0x00, /* |......##................| */
+    0x00, /* |........................| */
+    // @3335 'z'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x64, 0x52, 0x00, /* |......####.....##.......| */
+    0x64, 0x43, 0x00, /* |......####....###.......| */
+    0x62, 0x54, 0x00, /* |......##.....####.......| */
+    0x62, 0x42, 0x12, 0x00, /* |......##....##.##.......| */
+    0x62, 0x32, 0x22, 0x00, /* |......##...##..##.......| */
+    0x62, 0x22, 0x32, 0x00, /* |......##..##...##.......| */
+    0x62, 0x12, 0x42, 0x00, /* |......##.##....##.......| */
+    0x64, 0x52, 0x00, /* |......####.....##.......| */
+    0x63, 0x44, 0x00, /* |......###....####.......| */
+    0x62, 0x54, 0x00, /* |......##.....####.......| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @3376 '{'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xB1, 0x00, /* |...........#............| */
+    0xA3, 0x00, /* |..........###...........| */
+    0xF0, 0x03, 0x10, 0x00, /* |...################.....| */
+    0x29, 0x18, 0x00, /* |..#########.########....| */
+    0x22, 0xE2, 0x00, /* |..##..............##....| */
+    0x22, 0xE2, 0x00, /* |..##..............##....| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @3404 '|'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xF0, 0x02, 0x12, 0x00, /* |..##################....| */
+    0xF0, 0x02, 0x12, 0x00, /* |..##################....| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @3427 '}'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x22, 0xE2, 0x00, /* |..##..............##....| */
+    0x22, 0xE2, 0x00, /* |..##..............##....| */
+    0x29, 0x18, 0x00, /* |..#########.########....| */
+    0xF0, 0x03, 0x10, 0x00, /* |...################.....| */
+    0xA3, 0x00, /* |..........###...........| */
+    0xB1, 0x00, /* |...........#............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    // @3455 '~'
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0xA2, 0x00, /* |..........##............| */
+    0x93, 0x00, /* |.........###............| */
+    0x83, 0x00, /* |........###.............| */
+    0x82, 0x00, /* |........##..............| */
+    0x83, 0x00, /* |........###.............| */
+    0x93, 0x00, /* |.........###............| */
+    0xA3, 0x00, /* |..........###...........| */
+    0xB2, 0x00, /* |...........##...........| */
+    0xA3, 0x00, /* |..........###...........| */
+    0x93, 0x00, /* |.........###............| */
+    0x92, 0x00, /* |.........##.............| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+    0x00, /* |........................| */
+};
+
+const uint16_t Font24_SpanIndex[] = {
+    0, 17, 40, 63, 104, 144, 183, 224, 244, 270, 296, 325,
+    354, 380, 407, 428, 457, 490, 521, 566, 606, 644, 687, 728,
+    759, 802, 843, 868, 896, 937, 980, 1021, 1054, 1095, 1141, 1187,
+    1226, 1265, 1308, 1347, 1391, 1434, 1469, 1504, 1550, 1586, 1629, 1668,
+    1705, 1746, 1788, 1833, 1876, 1911, 1946, 1984, 2024, 2075, 2115, 2160,
+    2189, 2218, 2247, 2275, 2340, 2362, 2404, 2443, 2482, 2521, 2568, 2611,
+    2655, 2692, 2727, 2762, 2798, 2831, 2870, 2907, 2944, 2990, 3036, 3073,
+    3116, 3151, 3184, 3217, 3249, 3292, 3335, 3376, 3404, 3427, 3455,
+};
+
+sFONT Font24 = {
+    NULL,
+    17, /* Width */
+    24, /* Height */
+    Font24_Spans,
+    Font24_SpanIndex,
+    0x20, /* FirstChar */
+    95, /* CharCount */
+};
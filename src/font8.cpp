@@ -36,6 +36,7 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
 #include "fonts.h"
 
 // 
@@ -999,6 +1000,10 @@ sFONT Font8 = {
   Font8_Table,
   5, /* Width */
   8, /* Height */
+  NULL, /* Spans: bitmap table */
+  NULL,
+  0,
+  0,
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
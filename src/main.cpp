@@ -1,17 +1,30 @@
 #include <Arduino.h>
 #include <WiFi.h>
+#include <Preferences.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 #include <FS.h>
 #include <SPIFFS.h>
 #include <time.h>
+#include <stdarg.h>
+#include <stddef.h>
 #include <esp_sleep.h>
+#include <esp_system.h>
+#include <rom/crc.h>
+#include <esp_heap_caps.h>
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <esp_partition.h>
+#include <rom/miniz.h>
 
 // E-paper libraries
 #include "EPD_3in52b.h"
 #include "GUI_Paint.h"
+#include "GUI_Canvas.h"
 #include "fonts.h"
 #include "ImageData.h"
+#include "VerseRender.h"
+#include "Perf.h"
 
 // ---------------------------- Configuration ----------------------------
 
@@ -28,88 +41,419 @@ const int   daylightOffset_sec = 3600;  // DST offset if applicable
 UBYTE *BlackImage;
 UBYTE *RedImage;
 
+// Partial refresh: upload and refresh only the window that changed since the last frame
+const bool usePartialRefresh = true;
+const int  partialRefreshMaxPercent = 60;  // Larger changes fall back to a full refresh
+
+// Fast refresh: routine minute changes use a black/white waveform (under a
+// second, red ink is shown black until the next full refresh). A full
+// tri-color refresh clears the ghosting every fullRefreshEvery frames
+// (0 = never) and at the top of the hour.
+const bool useFastRefresh = true;
+const EPD_3IN52B_LUT fastRefreshLut = EPD_3IN52B_LUT_DU;  // Or EPD_3IN52B_LUT_GC: flashes, less ghosting
+const int  fullRefreshEvery = 15;
+const bool fullRefreshOnHour = true;
+RTC_DATA_ATTR int fastRefreshCount = 0;  // Fast refreshes since the last full one
+
+// Copy of the frame currently shown on the panel (for diffing)
+UBYTE *PrevBlackImage;
+UBYTE *PrevRedImage;
+bool prevFrameValid = false;
+
+// Panel and clock state that outlives the ESP32: the fingerprint of the frame
+// on the panel (an identical frame never reaches the panel), its minute (to
+// rebuild the panel copy, 0 = not a regular clock frame) and whether the RTC
+// holds NTP time. RTC_DATA_ATTR is re-initialized by every reset but a
+// deep-sleep wake; RTC_NOINIT_ATTR also survives brownout, software, panic
+// and watchdog resets. It is garbage after power-on, so it only counts with
+// the magic and the CRC (loadRtcState()); call sealRtcState() after changes.
+struct RtcState {
+    uint32_t magic;
+    uint32_t shownFrameCrc;
+    time_t shownFrameTime;
+    bool shownFrameCrcValid;
+    bool rtcTimeTrusted;   // Set by syncTime
+    uint32_t crc;          // Over everything above
+};
+const uint32_t rtcStateMagic = 0xB1B1EC10;
+RTC_NOINIT_ATTR RtcState rtcState;
+uint32_t &shownFrameCrc = rtcState.shownFrameCrc;
+bool &shownFrameCrcValid = rtcState.shownFrameCrcValid;
+time_t &shownFrameTime = rtcState.shownFrameTime;
+bool &rtcTimeTrusted = rtcState.rtcTimeTrusted;
+
+uint32_t rtcStateCrc() {
+    return crc32_le(0, (const uint8_t *)&rtcState, offsetof(RtcState, crc));
+}
+
+void sealRtcState() {
+    rtcState.magic = rtcStateMagic;
+    rtcState.crc = rtcStateCrc();
+}
+
+// At boot: true if rtcState survived the reset, else it starts over cleared
+bool loadRtcState() {
+    if (rtcState.magic == rtcStateMagic && rtcState.crc == rtcStateCrc()) {
+        return true;
+    }
+    memset(&rtcState, 0, sizeof(rtcState));
+    sealRtcState();
+    return false;
+}
+
+// Minute of the frame last rendered
+time_t renderedFrameTime = 0;
+
+// Deep-sleep scheduler: sleep the ESP32 and the panel between minute ticks
+// instead of delay(). Only RTC memory survives, every wake runs setup() again.
+const bool useDeepSleep = false;
+const long wakeGuardMs = 50;                 // Wake slightly after the minute boundary
+RTC_DATA_ATTR int64_t scheduledWakeMs = 0;   // Epoch ms the last sleep aimed for
+RTC_DATA_ATTR long wakeLatencyMs = 0;        // Learned boot time, subtracted from each sleep
+
+// Warm boot: after a reset that kept rtcState and the RTC time (brownout,
+// software reset, panic, watchdog, deep-sleep wake) skip the WiFi/NTP
+// start-up, the panel clear and the start-up delays, and draw the current
+// minute from the RTC time right away
+const bool useWarmBoot = true;
+
+// Pipelined rendering (loop mode): draw the next minute into a second pair of
+// buffers while the current one is shown, so at the boundary only the upload
+// and refresh remain. refreshLeadMs starts that refresh early so the panel
+// settles closer to the real minute.
+const bool usePipelinedRender = true;
+const long refreshLeadMs = 0;
+UBYTE *NextBlackImage;
+UBYTE *NextRedImage;
+time_t nextFrameTime = 0;  // Minute rendered into the Next buffers, 0 = none
+
+// Task split (loop mode, builds on usePipelinedRender): the renderer and the
+// panel I/O task run on core 1, WiFi and NTP on core 0. The panel task sleeps
+// on the BUSY interrupt during a refresh, and a WiFi reconnect or NTP sync
+// never holds up a frame.
+const bool useTaskSplit = true;
+const unsigned long netCheckIntervalMs = 5000UL;  // WiFi link / hourly sync check
+struct FrameMessage {
+    time_t minute;      // Minute the Next buffers were rendered for
+    PAINT_RECT dirty;   // What the renderer drew
+};
+QueueHandle_t frameQueue = NULL;           // renderer -> panel
+SemaphoreHandle_t nextBuffersFree = NULL;  // panel -> renderer: Next buffers may be drawn again
+
+// Light sleep during a refresh: the panel upload is followed by several
+// seconds of BUSY; with this set the chip light-sleeps until BUSY is
+// released instead of idling. Only used without the task split (the other
+// tasks would stall), and the WiFi link may drop while asleep.
+const bool lightSleepDuringRefresh = false;
+
 // Timing Variables
 unsigned long previousDisplayUpdateMillis = 0;
 unsigned long previousTimeSyncMillis = 0;
 const unsigned long displayUpdateIntervalMs = 60000UL;  // Update display every 60 seconds after the first update
-int lastSyncedHour = -1;
+RTC_DATA_ATTR int lastSyncedHour = -1;
+
+// Adaptive time sync: each NTP sync measures how far the RTC drifted since the
+// previous one, the drift is corrected between syncs and the interval grows
+// from hourly to daily while the clock stays within driftToleranceMs. WiFi is
+// only up for the sync and switched off in between. Hourly syncs otherwise.
+const bool useAdaptiveSync = true;
+const long syncIntervalMinSec = 3600L;
+const long syncIntervalMaxSec = 86400L;
+const long driftToleranceMs = 500;         // Clock error allowed to build up between syncs
+RTC_DATA_ATTR int64_t lastSyncMs = 0;      // Epoch ms of the last NTP sync, 0 = none
+RTC_DATA_ATTR int64_t lastDriftFixMs = 0;  // Epoch ms the drift correction was last applied
+RTC_DATA_ATTR float rtcDriftPpm = 0;       // RTC rate error, > 0 = RTC runs slow
+RTC_DATA_ATTR long syncIntervalSec = 3600L;
+RTC_DATA_ATTR int64_t syncRetryMs = 0;     // No attempt before this after a failed sync
+volatile bool ntpSyncDone = false;         // Set by the SNTP callback
 
-// JSON Document for the current hour's verses
-// Reduced size based on estimation. Adjust as needed.
-StaticJsonDocument<100000> hourDoc;
+// Fast reconnect: access point (BSSID, channel) and DHCP lease of the last
+// connection, kept in RTC memory and mirrored to NVS for cold boots. A
+// reconnect associates directly and reuses the address, skipping the scan and
+// DHCP; if that fails initWiFi() falls back to the full path. With
+// useStaticIp the configured address is used instead of the lease. A reused
+// lease is not renewed, reserve the address on the router to be safe.
+const bool useStaticIp = false;
+const IPAddress staticIp(192, 168, 1, 50);
+const IPAddress staticGateway(192, 168, 1, 1);
+const IPAddress staticSubnet(255, 255, 255, 0);
+const IPAddress staticDns(192, 168, 1, 1);
+const uint32_t wifiCacheMagic = 0x57434831;  // "WCH1"
+struct WiFiCache {
+    uint32_t magic;
+    uint8_t bssid[6];
+    int32_t channel;
+    uint32_t ip, gateway, subnet, dns;  // 0 = no lease
+};
+RTC_DATA_ATTR WiFiCache wifiCache;
+
+// Verse storage: compact binary index (verses.bin, built by parser.py), read
+// in place from the memory-mapped "verses" flash partition or else from
+// /verses.bin on SPIFFS, with the per-hour JSON files as fallback
+const bool useVersePartition = true;
+// A verse pack (parser.py pack) in the partition holds several translations:
+// the one to show, the first pack if none has this name
+const char *versePackName = "esv";
+const bool useBinaryVerseIndex = true;
 
-// Track the last loaded hour to prevent redundant loads
-int lastLoadedHour = -1;
+// Heap watch: log free heap, its low-water mark and fragmentation after every
+// update. The minute path does not allocate, so free heap should stay flat.
+const bool logHeapStats = true;
+size_t heapFreeLast = 0;            // Free heap after the previous update
+unsigned long heapDropCount = 0;    // Updates that ended with less free heap than the one before
 
-// Display Dimensions (Adjust based on your e-Paper display)
-const int displayWidth = EPD_3IN52B_HEIGHT - 5;  // Leave 5 pixels free on the right
-const int displayHeight = EPD_3IN52B_WIDTH;
+// Telemetry: awake time per phase, refreshes by type and battery voltage of
+// every cycle (a deep-sleep wake, or a minute in loop mode), kept in RTC
+// memory (see Perf.h) and posted as one JSON batch while WiFi is up for the
+// time sync. An empty URL keeps it on the device ('p' on Serial shows it).
+const char *telemetryUrl = "";          // e.g. "http://192.168.1.10:8080/clock"
+const int batteryAdcPin = -1;           // ADC1 pin (ADC2 is taken by WiFi) on the battery divider, -1 = none
+const float batteryDividerRatio = 2.0f; // Battery voltage / pin voltage
+unsigned heapWorstFragPercent = 0;
+
+// Pre-rendered verse planes in the "frames" flash partition (tools/prerender),
+// enabled by the esp32dev_frames environment. Drawn on the device otherwise.
+#ifndef USE_PRERENDERED_FRAMES
+#define USE_PRERENDERED_FRAMES 0
+#endif
 
 // --------------------------------------------------------------------
 // 1) Initialize WiFi
 // --------------------------------------------------------------------
+bool waitForWiFi(unsigned long timeoutMs) {
+    unsigned long wifiStart = millis();
+    while (WiFi.status() != WL_CONNECTED) {
+        delay(100);
+        if (millis() - wifiStart > timeoutMs) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// RTC memory is lost on power-up, NVS is not
+void loadWiFiCache() {
+    if (wifiCache.magic == wifiCacheMagic) {
+        return;
+    }
+    Preferences prefs;
+    if (!prefs.begin("wifi", true) ||
+        prefs.getBytes("cache", &wifiCache, sizeof(wifiCache)) != sizeof(wifiCache) ||
+        wifiCache.magic != wifiCacheMagic) {
+        memset(&wifiCache, 0, sizeof(wifiCache));
+    }
+    prefs.end();
+}
+
+// Remember the current connection, NVS is only written when it changed
+void storeWiFiCache() {
+    WiFiCache fresh;
+    memset(&fresh, 0, sizeof(fresh));
+    fresh.magic = wifiCacheMagic;
+    memcpy(fresh.bssid, WiFi.BSSID(), sizeof(fresh.bssid));
+    fresh.channel = WiFi.channel();
+    fresh.ip = WiFi.localIP();
+    fresh.gateway = WiFi.gatewayIP();
+    fresh.subnet = WiFi.subnetMask();
+    fresh.dns = WiFi.dnsIP();
+    if (memcmp(&fresh, &wifiCache, sizeof(fresh)) == 0) {
+        return;
+    }
+    wifiCache = fresh;
+    Preferences prefs;
+    if (prefs.begin("wifi", false)) {
+        prefs.putBytes("cache", &wifiCache, sizeof(wifiCache));
+        prefs.end();
+    }
+}
+
+// Static address, the cached lease or DHCP
+void configureAddress(bool useLease) {
+    if (useStaticIp) {
+        WiFi.config(staticIp, staticGateway, staticSubnet, staticDns);
+    } else if (useLease && wifiCache.ip != 0) {
+        WiFi.config(IPAddress(wifiCache.ip), IPAddress(wifiCache.gateway),
+                    IPAddress(wifiCache.subnet), IPAddress(wifiCache.dns));
+    } else {
+        WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+    }
+}
+
 void initWiFi() {
+    PerfScope timer(PERF_WIFI);
     Serial.print("Connecting to ");
     Serial.println(ssid);
-    WiFi.begin(ssid, password);
     unsigned long wifiStart = millis();
-    
-    while (WiFi.status() != WL_CONNECTED) {
-        delay(500);
-        Serial.print(".");
+    bool direct = false;
+
+    // Known access point: associate directly, no scan, no DHCP
+    loadWiFiCache();
+    if (wifiCache.magic == wifiCacheMagic) {
+        configureAddress(true);
+        WiFi.begin(ssid, password, wifiCache.channel, wifiCache.bssid);
+        direct = waitForWiFi(3000UL);
+        if (!direct) {
+            Serial.println("Cached access point not reachable, scanning.");
+            wifiCache.magic = 0;
+            WiFi.disconnect();
+        }
+    }
+
+    if (!direct) {
+        configureAddress(false);
+        WiFi.begin(ssid, password);
         // Timeout after 30 seconds
-        if (millis() - wifiStart > 30000UL) {
-            Serial.println("\nFailed to connect to WiFi.");
+        if (!waitForWiFi(30000UL)) {
+            Serial.println("Failed to connect to WiFi.");
             // Optionally, implement retry logic or enter a safe mode
             return;
         }
     }
-    
-    Serial.println("\nWiFi connected");
+    storeWiFiCache();
+
+    Serial.print("WiFi connected in ");
+    Serial.print(millis() - wifiStart);
+    Serial.println(direct ? " ms (cached)" : " ms (scan)");
     Serial.print("IP Address: ");
     Serial.println(WiFi.localIP());
 }
 
+void stopWiFi() {
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+}
+
 // --------------------------------------------------------------------
 // 2) Initialize Time via NTP
 // --------------------------------------------------------------------
+int64_t epochMillis() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+}
+
+void onNtpSync(struct timeval *) {
+    ntpSyncDone = true;
+}
+
+// Compare the clock the sync replaced with NTP time and adapt drift and interval.
+// stepMs > 0 means the RTC was behind.
+void recordClockStep(int64_t stepMs, int64_t syncedMs) {
+    int64_t sinceLastMs = syncedMs - lastSyncMs;
+    if (lastSyncMs == 0 || sinceLastMs < 600000L) {
+        return; // Too short a baseline to tell drift from jitter
+    }
+    // correctClockDrift() ran before every frame (each sync check in loop mode,
+    // each wake in deep sleep), what is left is the error of its estimate
+    rtcDriftPpm += (float)((double)stepMs * 1e6 / (double)sinceLastMs);
+    rtcDriftPpm = constrain(rtcDriftPpm, -100000.0f, 100000.0f);
+
+    if (labs((long)stepMs) <= driftToleranceMs) {
+        syncIntervalSec = min(syncIntervalSec * 2, syncIntervalMaxSec);
+    } else {
+        syncIntervalSec = max(syncIntervalSec / 2, syncIntervalMinSec);
+    }
+
+    Serial.print("Clock was off by ");
+    Serial.print((long)stepMs);
+    Serial.print(" ms after ");
+    Serial.print((long)(sinceLastMs / 1000));
+    Serial.print(" s, drift ");
+    Serial.print(rtcDriftPpm);
+    Serial.print(" ppm, next sync in ");
+    Serial.print(syncIntervalSec);
+    Serial.println(" s");
+}
+
+// Apply the estimated drift since the last correction to the system clock
+void correctClockDrift() {
+    if (!useAdaptiveSync || lastDriftFixMs == 0 || rtcDriftPpm == 0) {
+        return;
+    }
+    int64_t nowMs = epochMillis();
+    int64_t fixMs = (int64_t)((double)(nowMs - lastDriftFixMs) * rtcDriftPpm / 1e6);
+    if (fixMs > -20 && fixMs < 20) {
+        return; // Not worth a clock step yet
+    }
+    nowMs += fixMs;
+    struct timeval tv = { (time_t)(nowMs / 1000), (suseconds_t)((nowMs % 1000) * 1000) };
+    settimeofday(&tv, NULL);
+    lastDriftFixMs = nowMs;
+}
+
 bool syncTime() {
+    PerfScope timer(PERF_NTP);
+    // RTC time just before the sync, advanced by esp_timer while waiting,
+    // tells how far the clock had drifted
+    bool hadTime = rtcTimeTrusted && lastSyncMs != 0;
+    int64_t rtcBeforeMs = epochMillis();
+    int64_t timerBeforeUs = esp_timer_get_time();
+
+    ntpSyncDone = false;
+    sntp_set_time_sync_notification_cb(onNtpSync);
     configTime(gmtOffset_sec, daylightOffset_sec, ntpServer);
     Serial.println("Synchronizing time with NTP...");
     
-    struct tm timeinfo;
     unsigned long syncStart = millis();
     const unsigned long syncTimeout = 10000UL; // 10 seconds timeout
     
-    while (!getLocalTime(&timeinfo)) {
-        delay(500);
-        Serial.print(".");
+    // getLocalTime() succeeds on a clock that was already set, wait for the reply
+    while (!ntpSyncDone) {
+        delay(100);
         if (millis() - syncStart > syncTimeout) {
-            Serial.println("\nTime synchronization failed.");
+            Serial.println("Time synchronization failed.");
+            if (useAdaptiveSync) {
+                sntp_stop();
+            }
             return false;
         }
     }
+    if (useAdaptiveSync) {
+        sntp_stop(); // No background resyncs, the next one is scheduled here
+    }
     
-    Serial.println("\nTime synchronized");
+    int64_t syncedMs = epochMillis();
+    if (hadTime) {
+        int64_t expectedMs = rtcBeforeMs + (esp_timer_get_time() - timerBeforeUs) / 1000;
+        recordClockStep(syncedMs - expectedMs, syncedMs);
+    }
+    lastSyncMs = syncedMs;
+    lastDriftFixMs = syncedMs;
+
+    Serial.print("Time synchronized in ");
+    Serial.print(millis() - syncStart);
+    Serial.println(" ms");
+    rtcTimeTrusted = true;
+    sealRtcState();
     return true;
 }
 
 // --------------------------------------------------------------------
-// 3) Load JSON for the given hour from SPIFFS
+// 3) Stream the current minute out of the hour's JSON file on SPIFFS
 //    e.g., hour=3 -> "/bible_verses_hour03.json"
+//    The filter keeps only the matching "MM" entry, so the document stays
+//    a few hundred bytes instead of holding the whole hour in RAM.
 // --------------------------------------------------------------------
-bool loadBibleVersesForHour(int hour) {
-    // Clear previous JSON data
-    hourDoc.clear();
+bool mountVerseStorage() {
+    static bool mounted = false;
+    if (!mounted) {
+        mounted = SPIFFS.begin(true);
+        if (!mounted) {
+            Serial.println("SPIFFS Mount Failed");
+        }
+    }
+    return mounted;
+}
 
-    // Initialize SPIFFS
-    if (!SPIFFS.begin(true)) { 
-        Serial.println("SPIFFS Mount Failed");
+bool readVerseFromJson(const struct tm &timeinfo, char *reference, size_t referenceLen,
+                       char *text, size_t textLen) {
+    if (!mountVerseStorage()) {
         return false;
     }
 
     // Build the filename, e.g., "/bible_verses_hour03.json" for hour=3
-    // If hour=0, treat it as 24 in the calling code
+    // If hour=0, treat it as 24
+    int hour = timeinfo.tm_hour == 0 ? 24 : timeinfo.tm_hour;
     char filename[32];
     snprintf(filename, sizeof(filename), "/bible_verses_hour%02d.json", hour);
     
@@ -120,8 +464,21 @@ bool loadBibleVersesForHour(int hour) {
         return false;
     }
 
-    // Deserialize JSON
-    DeserializationError error = deserializeJson(hourDoc, file);
+    // Build minute as two-digit string: "00".."59"
+    char minuteStr[3];
+    snprintf(minuteStr, sizeof(minuteStr), "%02d", timeinfo.tm_min);
+
+    JsonDocument filter;
+    filter[minuteStr]["reference"] = true;
+    filter[minuteStr]["text"] = true;
+
+    // Deserialize only the current minute
+    JsonDocument doc;
+    DeserializationError error;
+    {
+        PerfScope timer(PERF_JSON_PARSE);
+        error = deserializeJson(doc, file, DeserializationOption::Filter(filter));
+    }
     file.close();
     if (error) {
         Serial.print("Failed to parse JSON for hour = ");
@@ -131,138 +488,716 @@ bool loadBibleVersesForHour(int hour) {
         return false;
     }
 
-    Serial.print("Loaded verses for hour ");
-    Serial.println(hour);
+    JsonObject entry = doc[minuteStr];
+    if (entry.isNull()) {
+        Serial.print("No entry found in JSON for minute ");
+        Serial.println(minuteStr);
+        return false;
+    }
+    if (!entry["reference"].is<const char *>() || !entry["text"].is<const char *>()) {
+        Serial.print("Missing 'reference' or 'text' in JSON for minute ");
+        Serial.println(minuteStr);
+        return false;
+    }
+
+    strlcpy(reference, entry["reference"] | "", referenceLen);
+    strlcpy(text, entry["text"] | "", textLen);
     return true;
 }
 
 // --------------------------------------------------------------------
 // 4) Retrieve both reference and verse based on a single time fetch
 // --------------------------------------------------------------------
+// No heap allocation per minute: the verse text stays in verseBlob and the
+// book name is written into VerseData, valid until the next lookup
+const size_t verseReferenceMax = 64;
+const size_t verseTextMax = 512;
+
 struct VerseData {
-    String reference;
-    String text;
+    char reference[verseReferenceMax + 3];  // Book name in brackets, "" if none
+    const char *text;                       // Points into verseBlob or the verses partition
+};
+
+// --------------------------------------------------------------------
+// 4b) Binary verse index: 1440-entry offset table + packed strings
+//     (layout documented in parser.py, write_verse_index)
+// --------------------------------------------------------------------
+struct VerseIndexEntry {
+    uint32_t offset;    // Absolute file offset of "reference\0text\0"
+    uint16_t refLen;
+    uint16_t textLen;
 };
+static_assert(sizeof(VerseIndexEntry) == 8, "VerseIndexEntry must match the file layout");
 
-// Helper function to extract the book name from the reference string with parentheses ()
-String extractBookName(const String &reference) {
-    int start = reference.indexOf('(');
-    int end = reference.indexOf(')');
-    if (start != -1 && end != -1 && end > start) {
-        String insideParentheses = reference.substring(start + 1, end);
-        return "[" + insideParentheses + "]"; // If no space, return the whole string with brackets
+const uint32_t verseIndexHeaderSize = 16;
+File verseIndexFile;
+bool verseIndexOpen = false;
+int indexedHour = -1;                  // tm_hour whose table slice is cached
+VerseIndexEntry hourIndex[60];
+char verseBlob[verseReferenceMax + 1 + verseTextMax + 1];  // "reference\0text\0"
+
+bool openVerseIndex() {
+    if (verseIndexOpen) {
+        return true;
     }
-    return ""; // Return empty string if format is unexpected
+    if (!mountVerseStorage()) {
+        return false;
+    }
+    verseIndexFile = SPIFFS.open("/verses.bin", "r");
+    if (!verseIndexFile) {
+        Serial.println("No /verses.bin, using JSON files.");
+        return false;
+    }
+
+    uint8_t header[verseIndexHeaderSize];
+    if (verseIndexFile.read(header, sizeof(header)) != sizeof(header) ||
+        memcmp(header, "BVRS", 4) != 0 ||
+        (header[4] | (header[5] << 8)) != 1 ||
+        (header[6] | (header[7] << 8)) != 24 * 60) {
+        Serial.println("Invalid /verses.bin header, using JSON files.");
+        verseIndexFile.close();
+        return false;
+    }
+    verseIndexOpen = true;
+    return true;
 }
 
-VerseData getCurrentVerseData(const struct tm &timeinfo) {
-    VerseData data;
-    
-    int hour = timeinfo.tm_hour;
-    int minute = timeinfo.tm_min;
+// Single seek + read per verse, the hour's 60 table entries are read once per hour
+bool readVerseFromIndex(const struct tm &timeinfo, VerseData &data) {
+    if (!openVerseIndex()) {
+        return false;
+    }
+
+    if (timeinfo.tm_hour != indexedHour) {
+        uint32_t tablePos = verseIndexHeaderSize + timeinfo.tm_hour * 60 * sizeof(VerseIndexEntry);
+        if (!verseIndexFile.seek(tablePos) ||
+            verseIndexFile.read((uint8_t *)hourIndex, sizeof(hourIndex)) != sizeof(hourIndex)) {
+            Serial.println("Failed to read verse index table.");
+            return false;
+        }
+        indexedHour = timeinfo.tm_hour;
+    }
+
+    const VerseIndexEntry &entry = hourIndex[timeinfo.tm_min];
+    size_t blobLen = (size_t)entry.refLen + 1 + entry.textLen + 1;
+    if (blobLen > sizeof(verseBlob)) {
+        Serial.println("Verse too long for buffer.");
+        return false;
+    }
+    if (!verseIndexFile.seek(entry.offset) ||
+        verseIndexFile.read((uint8_t *)verseBlob, blobLen) != blobLen) {
+        Serial.println("Failed to read verse.");
+        return false;
+    }
+    verseBlob[entry.refLen] = '\0';
+    verseBlob[blobLen - 1] = '\0';
+
+    VerseRender_BookName(verseBlob, data.reference, sizeof(data.reference));
+    data.text = verseBlob + entry.refLen + 1;
+    return true;
+}
 
-    // If hour=0, treat as 24
-    if (hour == 0) hour = 24;
+// --------------------------------------------------------------------
+// 4c) The same index memory-mapped from the "verses" partition: no mount,
+//     no file handle, the text is used straight from the flash cache
+// --------------------------------------------------------------------
+const uint8_t *verseStore = NULL;
+size_t verseStoreSize = 0;
+spi_flash_mmap_handle_t verseStoreHandle;
+
+// --------------------------------------------------------------------
+// 4d) Verse pack: per translation and hour a raw deflate block (layout
+//     documented in parser.py, write_verse_pack). The active pack's hour
+//     is inflated through a 4 KB ring, just far enough for the minute
+//     asked for, and picked up there for the next minute.
+// --------------------------------------------------------------------
+const size_t versePackRecordSize = 16 + 24 * 8;
+const size_t versePackRingSize = 4096;         // The deflate window parser.py packs with
+const size_t versePackHeadSize = 60 * 4;       // u16 reference and text length per minute
+
+const uint8_t *versePackHours = NULL;  // Hour table of the active pack, NULL = no pack
+tinfl_decompressor *versePackInflator = NULL;
+uint8_t *versePackRing = NULL;
+
+struct VersePackStream {
+    int hour;                          // tm_hour being inflated, -1 = none
+    const uint8_t *in;                 // Rest of its deflate block
+    size_t inLeft;
+    size_t produced;                   // Bytes of the hour inflated so far
+    bool finished;
+    uint8_t head[versePackHeadSize];
+};
+VersePackStream versePackStream = { -1 };
 
-    // Load JSON for the current hour if not already loaded
-    if (hour != lastLoadedHour) {
-        if (!loadBibleVersesForHour(hour)) {
-            Serial.println("Failed to load data for this hour.");
-            return data;  // Return empty data
+bool openVersePack(const uint8_t *image, size_t partSize) {
+    uint16_t count = image[6] | (image[7] << 8);
+    uint32_t tableOffset, totalSize;
+    memcpy(&tableOffset, image + 8, 4);
+    memcpy(&totalSize, image + 12, 4);
+    // Bounds by subtraction, offset + length could wrap the 32-bit size_t
+    if ((image[4] | (image[5] << 8)) != 1 || count == 0 || totalSize > partSize ||
+        tableOffset > totalSize || count * versePackRecordSize > totalSize - tableOffset) {
+        Serial.println("Invalid verse pack, using SPIFFS.");
+        return false;
+    }
+
+    const uint8_t *record = image + tableOffset;
+    for (uint16_t i = 0; i < count; i++) {
+        const char *name = (const char *)image + tableOffset + i * versePackRecordSize;
+        if (strncmp(name, versePackName, 16) == 0) {
+            record = (const uint8_t *)name;
+        }
+    }
+    for (int hour = 0; hour < 24; hour++) {
+        uint32_t offset, length;
+        memcpy(&offset, record + 16 + hour * 8, 4);
+        memcpy(&length, record + 20 + hour * 8, 4);
+        if (offset > totalSize || length > totalSize - offset) {
+            Serial.println("Invalid verse pack, using SPIFFS.");
+            return false;
         }
-        lastLoadedHour = hour;
     }
 
-    // Build minute as two-digit string: "00".."59"
-    char minuteStr[3];
-    snprintf(minuteStr, sizeof(minuteStr), "%02d", minute);
-
-    // Retrieve reference and text from JSON
-    JsonObject entry = hourDoc[minuteStr];
-    if (!entry.isNull()) {
-        if (entry.containsKey("reference") && entry.containsKey("text")) {
-            String fullReference = entry["reference"].as<String>();
-            data.reference = extractBookName(fullReference); // Now includes brackets
-            data.text = entry["text"].as<String>();
-        } else {
-            Serial.print("Missing 'reference' or 'text' in JSON for minute ");
-            Serial.println(minuteStr);
+    // Once, the minute path does not allocate
+    versePackInflator = (tinfl_decompressor *)malloc(sizeof(tinfl_decompressor));
+    versePackRing = (uint8_t *)malloc(versePackRingSize);
+    if (!versePackInflator || !versePackRing) {
+        Serial.println("Failed to allocate verse pack buffers.");
+        free(versePackInflator);
+        free(versePackRing);
+        return false;
+    }
+    versePackHours = record + 16;
+    Serial.printf("Verse pack '%.16s' (%u in partition)\n", (const char *)record, (unsigned)count);
+    return true;
+}
+
+bool openVerseStore() {
+    static bool tried = false;
+    if (tried) {
+        return verseStore != NULL;
+    }
+    tried = true;
+
+    const esp_partition_t *part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "verses");
+    if (!part) {
+        Serial.println("No verses partition, using SPIFFS.");
+        return false;
+    }
+    const void *mapped;
+    if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &mapped, &verseStoreHandle) != ESP_OK) {
+        Serial.println("Failed to map verses partition.");
+        return false;
+    }
+
+    const uint8_t *header = (const uint8_t *)mapped;
+    uint32_t totalSize;
+    memcpy(&totalSize, header + 12, 4);
+    if (memcmp(header, "BVPK", 4) == 0) {
+        if (!openVersePack(header, part->size)) {
+            spi_flash_munmap(verseStoreHandle);
+            return false;
         }
-    } else {
-        Serial.print("No entry found in JSON for minute ");
-        Serial.println(minuteStr);
+    } else if (memcmp(header, "BVRS", 4) != 0 ||
+        (header[4] | (header[5] << 8)) != 1 ||
+        (header[6] | (header[7] << 8)) != 24 * 60 ||
+        totalSize > part->size || totalSize < verseIndexHeaderSize + 24 * 60 * sizeof(VerseIndexEntry)) {
+        Serial.println("Empty or invalid verses partition, using SPIFFS.");
+        spi_flash_munmap(verseStoreHandle);
+        return false;
+    }
+    verseStore = (const uint8_t *)mapped;
+    verseStoreSize = totalSize;
+    return true;
+}
+
+// Copy the part of [from, to) of the hour that lies in [begin, end), the
+// bytes last inflated into the ring
+void versePackCopy(size_t begin, size_t end, size_t from, size_t to, uint8_t *dst) {
+    for (size_t pos = max(begin, from); pos < min(end, to); pos++) {
+        dst[pos - from] = versePackRing[pos & (versePackRingSize - 1)];
+    }
+}
+
+// Inflate the hour until `until` bytes are out, copying [from, to) into dst
+bool versePackInflate(size_t until, size_t from, size_t to, uint8_t *dst) {
+    VersePackStream &st = versePackStream;
+    while (st.produced < until) {
+        if (st.finished) {
+            return false;
+        }
+        size_t pos = st.produced & (versePackRingSize - 1);
+        size_t inLen = st.inLeft;
+        size_t outLen = versePackRingSize - pos;
+        tinfl_status status = tinfl_decompress(versePackInflator, st.in, &inLen,
+                                               versePackRing, versePackRing + pos, &outLen, 0);
+        st.in += inLen;
+        st.inLeft -= inLen;
+        size_t begin = st.produced;
+        st.produced += outLen;
+        versePackCopy(begin, st.produced, 0, versePackHeadSize, st.head);
+        if (dst) {
+            versePackCopy(begin, st.produced, from, to, dst);
+        }
+        if (status == TINFL_STATUS_DONE) {
+            st.finished = true;
+        } else if (status != TINFL_STATUS_HAS_MORE_OUTPUT || (inLen == 0 && outLen == 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool versePackStartHour(int hour) {
+    VersePackStream &st = versePackStream;
+    uint32_t offset, length;
+    memcpy(&offset, versePackHours + hour * 8, 4);
+    memcpy(&length, versePackHours + hour * 8 + 4, 4);
+    st.hour = hour;
+    st.in = verseStore + offset;
+    st.inLeft = length;
+    st.produced = 0;
+    st.finished = false;
+    tinfl_init(versePackInflator);
+    if (!versePackInflate(versePackHeadSize, 0, 0, NULL)) {
+        st.hour = -1;
+        return false;
+    }
+    return true;
+}
+
+// Same contract as readVerseFromIndex(): the text is copied into verseBlob
+bool readVerseFromPack(const struct tm &timeinfo, VerseData &data) {
+    VersePackStream &st = versePackStream;
+    if (st.hour != timeinfo.tm_hour && !versePackStartHour(timeinfo.tm_hour)) {
+        Serial.println("Failed to inflate verse pack hour.");
+        return false;
+    }
+
+    size_t start = versePackHeadSize;
+    uint16_t refLen = 0, textLen = 0;
+    for (int minute = 0; minute <= timeinfo.tm_min; minute++) {
+        refLen = st.head[minute * 4] | (st.head[minute * 4 + 1] << 8);
+        textLen = st.head[minute * 4 + 2] | (st.head[minute * 4 + 3] << 8);
+        if (minute < timeinfo.tm_min) {
+            start += refLen + 1 + textLen + 1;
+        }
+    }
+    size_t blobLen = (size_t)refLen + 1 + textLen + 1;
+    if (refLen > verseReferenceMax || textLen > verseTextMax) {
+        Serial.println("Verse too long for buffer.");
+        return false;
     }
 
-    return data;
+    // An earlier minute whose bytes already left the ring: start over
+    if (st.produced > start + versePackRingSize) {
+        if (!versePackStartHour(timeinfo.tm_hour)) {
+            Serial.println("Failed to inflate verse pack hour.");
+            return false;
+        }
+    }
+    size_t ringStart = st.produced > versePackRingSize ? st.produced - versePackRingSize : 0;
+    versePackCopy(ringStart, st.produced, start, start + blobLen, (uint8_t *)verseBlob);
+    if (!versePackInflate(start + blobLen, start, start + blobLen, (uint8_t *)verseBlob)) {
+        st.hour = -1;
+        Serial.println("Failed to inflate verse pack hour.");
+        return false;
+    }
+    verseBlob[refLen] = '\0';
+    verseBlob[blobLen - 1] = '\0';
+
+    VerseRender_BookName(verseBlob, data.reference, sizeof(data.reference));
+    data.text = verseBlob + refLen + 1;
+    return true;
+}
+
+// Only the book name is copied, data.text points into the mapping
+bool readVerseFromStore(const struct tm &timeinfo, VerseData &data) {
+    if (!openVerseStore()) {
+        return false;
+    }
+    if (versePackHours) {
+        return readVerseFromPack(timeinfo, data);
+    }
+
+    VerseIndexEntry entry;
+    memcpy(&entry, verseStore + verseIndexHeaderSize + (timeinfo.tm_hour * 60 + timeinfo.tm_min) * sizeof(entry),
+           sizeof(entry));
+    // By subtraction, offset + length could wrap the 32-bit size_t
+    size_t blobLen = (size_t)entry.refLen + 1 + entry.textLen + 1;
+    if (entry.offset >= verseStoreSize || blobLen > verseStoreSize - entry.offset) {
+        Serial.println("Invalid verse in verses partition.");
+        return false;
+    }
+    const char *blob = (const char *)verseStore + entry.offset;
+    if (blob[entry.refLen] != '\0' || blob[blobLen - 1] != '\0') {
+        Serial.println("Invalid verse in verses partition.");
+        return false;
+    }
+
+    VerseRender_BookName(blob, data.reference, sizeof(data.reference));
+    data.text = blob + entry.refLen + 1;
+    return true;
+}
+
+// The JSON fallback still allocates (ArduinoJson, SPIFFS file handle), the
+// binary index paths do not
+bool getCurrentVerseData(const struct tm &timeinfo, VerseData &data) {
+    PerfScope timer(PERF_VERSE_LOOKUP);
+    data.reference[0] = '\0';
+    data.text = "";
+
+    if (useVersePartition && readVerseFromStore(timeinfo, data)) {
+        return true;
+    }
+    if (useBinaryVerseIndex && readVerseFromIndex(timeinfo, data)) {
+        return true;
+    }
+
+    if (!readVerseFromJson(timeinfo, verseBlob, verseReferenceMax + 1,
+                           verseBlob + verseReferenceMax + 1, verseTextMax + 1)) {
+        Serial.println("Failed to load data for this minute.");
+        return false;
+    }
+    VerseRender_BookName(verseBlob, data.reference, sizeof(data.reference)); // Includes brackets
+    data.text = verseBlob + verseReferenceMax + 1;
+    return true;
 }
 
 // --------------------------------------------------------------------
 // 5) Display Content: Time, Reference, and Verse
 // --------------------------------------------------------------------
-void displayContent(const String &currentTimeStr, const String &reference, const String &verseText) {
-    // Clear both images
-    Paint_SelectImage(RedImage);
-    Paint_Clear(WHITE);  // Clear with white background
-    // Draw Time at Top Center with Font32 in Red on White Background
-    int timeTextLength = currentTimeStr.length(); // Should be 5 for "HH:MM"
-    int timeFontWidth = Font32.Width * timeTextLength;
-    int timeX = (displayWidth - timeFontWidth) / 2;
-    Paint_DrawString_EN(timeX, 10, currentTimeStr.c_str(), &Font32, WHITE, RED);
-
-    // Draw Reference Book if available
-    if (!reference.isEmpty()) {
-        int refTextLength = reference.length(); // Should include brackets, e.g., "(John)"
-        int refFontWidth = Font20.Width * refTextLength;
-        int refX = (displayWidth - refFontWidth) / 2; // Center horizontally
-        Paint_DrawString_EN(refX, 50, reference.c_str(), &Font20, WHITE, RED);
-    }
-
-    // Determine appropriate font size for verse based on length
-    sFONT *verseFont;
-    if (verseText.length() < 80) {
-        verseFont = &Font24;
-    } else if (verseText.length() < 120) {
-        verseFont = &Font20;
-    } else if (verseText.length() < 240) {
-        verseFont = &Font16;
+UWORD imageSize() {
+    return ((EPD_3IN52B_WIDTH % 8 == 0)
+            ? (EPD_3IN52B_WIDTH / 8)
+            : (EPD_3IN52B_WIDTH / 8 + 1))
+            * EPD_3IN52B_HEIGHT;
+}
+
+// Hand the plane bytes of the upload that just finished to the timing report
+UDOUBLE reportBytesSent() {
+    UDOUBLE sent = EPD_3IN52B_TakeBytesSent();
+    Perf_RecordUploadBytes(sent);
+    return sent;
+}
+
+// Whether the fast-refresh policy asks for a full tri-color refresh now
+// (every fullRefreshEvery frames, at the top of the hour, and for frames that
+// are not regular clock frames while fast refreshes are left uncleaned: a
+// window refresh would keep their ghosting)
+bool fullRefreshDue(time_t frameTime) {
+    if (!useFastRefresh) {
+        return false;
+    }
+    if (fullRefreshEvery > 0 && fastRefreshCount >= fullRefreshEvery) {
+        return true;
+    }
+    if (frameTime == 0) {
+        return fastRefreshCount > 0;
+    }
+    struct tm frameTm;
+    localtime_r(&frameTime, &frameTm);
+    return fullRefreshOnHour && frameTm.tm_min == 0;
+}
+
+// Whether the frame may use the fast waveform instead of a tri-color refresh
+bool fastRefreshAllowed(time_t frameTime) {
+    return useFastRefresh && prevFrameValid && frameTime != 0 && !fullRefreshDue(frameTime);
+}
+
+// Block until the refresh started by showFrame() has finished
+void waitPanelIdle() {
+    PerfScope timer(PERF_BUSY);
+    bool taskSplit = useTaskSplit && usePipelinedRender && !useDeepSleep;
+    if (lightSleepDuringRefresh && !taskSplit) {
+        Serial.flush();
+        EPD_3IN52B_SleepUntilIdle();
     } else {
-        verseFont = &Font12;
+        EPD_3IN52B_WaitIdle();
     }
+}
 
-    Paint_SelectImage(BlackImage);
-    Paint_Clear(WHITE);  // Clear with white background
-    // Calculate verse position
-    int verseX = 10; // Starting X position with some padding
-    int verseY = reference.isEmpty() ? 60 : 90; // Adjust Y based on whether reference is present
+// showFrame() returns right after the upload when cleared, the next panel
+// command waits for the refresh (the warm boot syncs meanwhile)
+bool waitForRefresh = true;
+
+uint32_t frameFingerprint(const UBYTE *black, const UBYTE *red) {
+    uint32_t crc = crc32_le(0, black, imageSize());
+    return crc32_le(crc, red, imageSize());
+}
+
+// Send BlackImage/RedImage to the panel, limited to the changed window when
+// possible. dirty bounds what was drawn since the previous frame, frameTime is
+// the minute shown (0 = not a regular clock frame).
+void showFrame(const PAINT_RECT &dirty, time_t frameTime) {
+    uint32_t frameCrc = frameFingerprint(BlackImage, RedImage);
+    if (shownFrameCrcValid && frameCrc == shownFrameCrc) {
+        Serial.println("Frame fingerprint unchanged. Skipping display update.");
+        Perf_RecordRefresh(PERF_REFRESH_NONE);
+        return;
+    }
+    EPD_3IN52B_TakeBytesSent(); // Count only this frame's upload
+
+    // Frames the fast waveform may not be used for take the tri-color paths
+    // below, a full one when the fast-refresh policy asks for a cleanup
+    bool fast = fastRefreshAllowed(frameTime);
+    if (fast) {
+        {
+            PerfScope upload(PERF_UPLOAD);
+            EPD_3IN52B_DisplayFastAsync(PrevBlackImage, PrevRedImage, BlackImage, RedImage, fastRefreshLut, NULL);
+        }
+        fastRefreshCount++;
+        Perf_RecordRefresh(PERF_REFRESH_FAST);
+        Serial.printf("Display updated (fast, %u bytes).\n", (unsigned)reportBytesSent());
+    } else if (fullRefreshDue(frameTime) || !usePartialRefresh || !prevFrameValid) {
+        // Planes equal to the shown ones stay in the controller RAM
+        UBYTE planes = EPD_3IN52B_PLANE_ALL;
+        if (prevFrameValid) {
+            planes = 0;
+            if (memcmp(BlackImage, PrevBlackImage, imageSize()) != 0) planes |= EPD_3IN52B_PLANE_BLACK;
+            if (memcmp(RedImage, PrevRedImage, imageSize()) != 0) planes |= EPD_3IN52B_PLANE_RED;
+        }
+        {
+            PerfScope upload(PERF_UPLOAD);
+            EPD_3IN52B_DisplayPlanesAsync(BlackImage, RedImage, planes, NULL);
+        }
+        fastRefreshCount = 0;
+        Perf_RecordRefresh(PERF_REFRESH_FULL);
+        Serial.printf("Display updated (full, %u bytes).\n", (unsigned)reportBytesSent());
+    } else {
+        PAINT_RECT blackRect = dirty;
+        PAINT_RECT redRect = dirty;
+        bool blackChanged = Paint_DiffRect(BlackImage, PrevBlackImage, &blackRect);
+        bool redChanged = Paint_DiffRect(RedImage, PrevRedImage, &redRect);
+        if (!blackChanged && !redChanged) {
+            Serial.println("Frame unchanged. Skipping display update.");
+            Perf_RecordRefresh(PERF_REFRESH_NONE);
+            return;
+        }
+        UBYTE planes = (blackChanged ? EPD_3IN52B_PLANE_BLACK : 0) | (redChanged ? EPD_3IN52B_PLANE_RED : 0);
+
+        // Union of both planes' changes
+        PAINT_RECT win = blackChanged ? blackRect : redRect;
+        if (blackChanged && redChanged) {
+            win.Xstart = min(blackRect.Xstart, redRect.Xstart);
+            win.Ystart = min(blackRect.Ystart, redRect.Ystart);
+            win.Xend = max(blackRect.Xend, redRect.Xend);
+            win.Yend = max(blackRect.Yend, redRect.Yend);
+        }
+
+        UDOUBLE winArea = (UDOUBLE)(win.Xend - win.Xstart) * (win.Yend - win.Ystart);
+        UDOUBLE fullArea = (UDOUBLE)EPD_3IN52B_WIDTH * EPD_3IN52B_HEIGHT;
+        if (winArea * 100 > fullArea * partialRefreshMaxPercent) {
+            {
+                PerfScope upload(PERF_UPLOAD);
+                EPD_3IN52B_DisplayPlanesAsync(BlackImage, RedImage, planes, NULL);
+            }
+            fastRefreshCount = 0;
+            Perf_RecordRefresh(PERF_REFRESH_FULL);
+            Serial.printf("Display updated (full, %u bytes).\n", (unsigned)reportBytesSent());
+        } else {
+            {
+                PerfScope upload(PERF_UPLOAD);
+                EPD_3IN52B_DisplayWindowPlanesAsync(win.Xstart, win.Ystart,
+                                                    win.Xend - win.Xstart, win.Yend - win.Ystart,
+                                                    BlackImage, RedImage, planes, NULL);
+            }
+            Perf_RecordRefresh(PERF_REFRESH_WINDOW);
+            Serial.printf("Display updated (window %ux%u, %u bytes).\n", (unsigned)(win.Xend - win.Xstart),
+                          (unsigned)(win.Yend - win.Ystart), (unsigned)reportBytesSent());
+        }
+    }
+
+    // The planes are uploaded, copy them while the panel refreshes
+    memcpy(PrevBlackImage, BlackImage, imageSize());
+    memcpy(PrevRedImage, RedImage, imageSize());
+    prevFrameValid = true;
+    shownFrameCrc = frameCrc;
+    shownFrameCrcValid = true;
+    shownFrameTime = frameTime;
+    sealRtcState();
+    if (waitForRefresh) {
+        waitPanelIdle();
+    }
+}
+
+// Show what was drawn through Paint since the last frame
+void presentFrame() {
+    PAINT_RECT dirty;
+    if (!Paint_GetDirtyRect(&dirty)) {
+        Serial.println("Nothing drawn. Skipping display update.");
+        return;
+    }
+    showFrame(dirty, renderedFrameTime);
+    Paint_ResetDirty();
+}
+
+// Draw the frame into BlackImage/RedImage without touching the panel
+void renderContent(const char *currentTimeStr, const char *reference, const char *verseText) {
+    PerfScope timer(PERF_RENDER);
+    VerseRender_Frame(BlackImage, RedImage, currentTimeStr, reference, verseText);
+}
 
-    // Wrap and center the verse text
-    // Assuming Paint_DrawString_EN_WordWrap handles wrapping based on font size and display width
-    Paint_DrawString_EN_WordWrap(verseX, verseY, verseText.c_str(), verseFont, WHITE, BLACK, 2);
+void displayContent(const char *currentTimeStr, const char *reference, const char *verseText) {
+    renderContent(currentTimeStr, reference, verseText);
+    renderedFrameTime = 0;
 
     // Update e-Paper Display
-    EPD_3IN52B_Display(BlackImage, RedImage);   // Red layer
-    Serial.println("Display updated.");
+    presentFrame();
 }
 
+#if USE_PRERENDERED_FRAMES
+// --------------------------------------------------------------------
+// 5b) Pre-rendered verse planes: the black plane of every minute, raw
+//     deflate, memory-mapped from the "frames" partition
+//     (layout documented in tools/prerender/prerender.cpp)
+// --------------------------------------------------------------------
+struct FrameIndexEntry {
+    uint32_t offset;    // Partition offset of the deflate stream
+    uint32_t length;    // Compressed length, 0 = no frame for this minute
+    uint32_t verseCrc;  // crc32 of the verse text + has-book byte it was drawn from
+};
+static_assert(sizeof(FrameIndexEntry) == 12, "FrameIndexEntry must match the file layout");
+
+const uint32_t frameStoreHeaderSize = 16;
+const uint8_t *frameStore = NULL;
+size_t frameStoreSize = 0;
+spi_flash_mmap_handle_t frameStoreHandle;
+tinfl_decompressor frameInflator;  // ~11 KB, too big for the loop task stack
+
+bool openFrameStore() {
+    static bool tried = false;
+    if (tried) {
+        return frameStore != NULL;
+    }
+    tried = true;
+
+    const esp_partition_t *part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "frames");
+    if (!part) {
+        Serial.println("No frames partition, drawing verses.");
+        return false;
+    }
+    const void *mapped;
+    if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &mapped, &frameStoreHandle) != ESP_OK) {
+        Serial.println("Failed to map frames partition.");
+        return false;
+    }
+
+    const uint8_t *header = (const uint8_t *)mapped;
+    uint32_t planeSize, totalSize;
+    memcpy(&planeSize, header + 8, 4);
+    memcpy(&totalSize, header + 12, 4);
+    if (memcmp(header, "BVFR", 4) != 0 ||
+        (header[4] | (header[5] << 8)) != 1 ||
+        (header[6] | (header[7] << 8)) != 24 * 60 ||
+        planeSize != imageSize() || totalSize > part->size) {
+        Serial.println("Invalid frames partition, drawing verses.");
+        spi_flash_munmap(frameStoreHandle);
+        return false;
+    }
+    frameStore = (const uint8_t *)mapped;
+    frameStoreSize = totalSize;
+    return true;
+}
+
+// Inflate this minute's verse plane into black. Refuses frames that were not
+// rendered from exactly this verse, so a stale partition falls back to drawing.
+bool loadPrerenderedVerse(const struct tm &timeinfo, const char *verseText, bool hasBookName, UBYTE *black) {
+    if (!openFrameStore()) {
+        return false;
+    }
+    FrameIndexEntry entry;
+    memcpy(&entry, frameStore + frameStoreHeaderSize + (timeinfo.tm_hour * 60 + timeinfo.tm_min) * sizeof(entry),
+           sizeof(entry));
+    if (entry.length == 0 || entry.offset > frameStoreSize ||
+        entry.length > frameStoreSize - entry.offset) {
+        return false;
+    }
+    uint8_t hasBook = hasBookName ? 1 : 0;
+    uint32_t crc = crc32_le(0, (const uint8_t *)verseText, strlen(verseText));
+    if (crc32_le(crc, &hasBook, 1) != entry.verseCrc) {
+        return false;
+    }
+
+    size_t inLen = entry.length;
+    size_t outLen = imageSize();
+    tinfl_init(&frameInflator);
+    tinfl_status status = tinfl_decompress(&frameInflator, frameStore + entry.offset, &inLen,
+                                           black, black, &outLen,
+                                           TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+    return status == TINFL_STATUS_DONE && outLen == imageSize();
+}
+#endif
+
 // --------------------------------------------------------------------
 // 6) Update display with time and corresponding bible verse
 // --------------------------------------------------------------------
+// Start of the minute timeinfo falls in, as recorded for shown frames
+time_t minuteStart(const struct tm &timeinfo) {
+    struct tm start = timeinfo;
+    start.tm_sec = 0;
+    return mktime(&start);
+}
+
+// Render the frame for the given minute into black/red, false if there is no verse data
+bool renderFrameForTime(const struct tm &timeinfo, UBYTE *black, UBYTE *red) {
+    char timeBuffer[6]; // HH:MM
+    snprintf(timeBuffer, sizeof(timeBuffer), "%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
+    VerseData verse;
+    if (!getCurrentVerseData(timeinfo, verse) || (verse.reference[0] == '\0' && verse.text[0] == '\0')) {
+        return false;
+    }
+    PerfScope timer(PERF_RENDER);
+    bool prerendered = false;
+#if USE_PRERENDERED_FRAMES
+    prerendered = loadPrerenderedVerse(timeinfo, verse.text, verse.reference[0] != '\0', black);
+#endif
+    if (prerendered) {
+        VerseRender_Header(red, timeBuffer, verse.reference);
+        Paint_MarkAllDirty(); // The black plane was inflated behind Paint's back
+    } else {
+        VerseRender_Frame(black, red, timeBuffer, verse.reference, verse.text);
+    }
+    return true;
+}
+
+void reportHeap() {
+    size_t freeBytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    size_t lowWater = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+    size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    unsigned fragPercent = freeBytes ? 100 - (unsigned)(largest * 100 / freeBytes) : 0;
+
+    if (heapFreeLast != 0 && freeBytes < heapFreeLast) {
+        heapDropCount++;
+    }
+    heapFreeLast = freeBytes;
+    if (fragPercent > heapWorstFragPercent) {
+        heapWorstFragPercent = fragPercent;
+    }
+
+    Serial.printf("Heap: free %u, low-water %u, largest block %u, fragmentation %u%% (worst %u%%), drops %lu\n",
+                  (unsigned)freeBytes, (unsigned)lowWater, (unsigned)largest,
+                  fragPercent, heapWorstFragPercent, heapDropCount);
+}
+
 void updateDisplay() {
   struct tm currentTime;
   if (getLocalTime(&currentTime)) { // Refresh time after delay
       struct tm frozenTimeinfo = currentTime; // Freeze timeinfo immediately
-      char timeBuffer[6]; // HH:MM
-      snprintf(timeBuffer, sizeof(timeBuffer), "%02d:%02d", frozenTimeinfo.tm_hour, frozenTimeinfo.tm_min);
-      String currentTimeStr = String(timeBuffer);
-      VerseData verse = getCurrentVerseData(frozenTimeinfo);
-      if (!verse.reference.isEmpty() || !verse.text.isEmpty()) {
-          displayContent(currentTimeStr, verse.reference, verse.text);
+      if (renderFrameForTime(frozenTimeinfo, BlackImage, RedImage)) {
+          renderedFrameTime = minuteStart(frozenTimeinfo);
+          presentFrame();
       } else {
           Serial.println("Initial verse data is empty. Skipping display.");
       }
   } else {
       Serial.println("Failed to retrieve current time.");
   }
+  if (logHeapStats) {
+      reportHeap();
+  }
 }
 
 // --------------------------------------------------------------------
@@ -270,67 +1205,209 @@ void updateDisplay() {
 // --------------------------------------------------------------------
 unsigned long millisUntilNextMinute(const struct tm &timeinfo) {
     int seconds = timeinfo.tm_sec;
-    int millisec = millis() % 1000;
+    struct timeval tv;
+    gettimeofday(&tv, NULL);  // Sub-second part of the wall clock, millis() is not aligned to it
+    int millisec = tv.tv_usec / 1000;
     unsigned long remainingSeconds = 59 - seconds;
     unsigned long remainingMillis = 1000 - millisec;
     return (remainingSeconds * 1000UL) + remainingMillis;
 }
 
 // --------------------------------------------------------------------
-// 8) Check for time sync at the beginning of each new hour
+// 7b) Telemetry: close a cycle, post the pending ones with the time sync
 // --------------------------------------------------------------------
-void checkTimeSync() {
-    struct tm timeinfo;
-    if (!getLocalTime(&timeinfo)) {
-        Serial.println("Failed to retrieve current time.");
-        return;
+uint16_t readBatteryMv() {
+    if (batteryAdcPin < 0) {
+        return 0;
+    }
+    uint32_t mv = 0;
+    for (int i = 0; i < 4; i++) {
+        mv += analogReadMilliVolts(batteryAdcPin);
+    }
+    return (uint16_t)(mv / 4 * batteryDividerRatio);
+}
+
+void endTelemetryCycle() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    Perf_EndCycle((uint32_t)tv.tv_sec, readBatteryMv());
+}
+
+// snprintf() at pos, false once the buffer is full
+bool appendJson(char *buf, size_t size, size_t &pos, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf + pos, size - pos, fmt, args);
+    va_end(args);
+    if (n < 0 || (size_t)n >= size - pos) {
+        return false;
     }
+    pos += n;
+    return true;
+}
 
-    // Check if the hour has changed since the last sync
-    if (timeinfo.tm_hour != lastSyncedHour) {
-        lastSyncedHour = timeinfo.tm_hour;  // Update the last synced hour
+// Totals since the last upload and the cycles as rows of "fields"
+size_t formatTelemetry(char *buf, size_t size, const PERF_TELEMETRY &t, const PERF_CYCLE *cycles, uint16_t count) {
+    size_t pos = 0;
+    bool ok = appendJson(buf, size, pos, "{\"device\":\"%012llx\",\"cycles\":%u,\"dropped\":%u,"
+                         "\"awake_ms\":%llu,\"battery_min_mv\":%u,\"phase_ms\":{",
+                         (unsigned long long)ESP.getEfuseMac(), (unsigned)t.Cycles, (unsigned)t.Dropped,
+                         (unsigned long long)t.AwakeMs, (unsigned)t.BatteryMinMv);
+    for (int i = 0; ok && i < PERF_PHASE_COUNT; i++) {
+        ok = appendJson(buf, size, pos, "%s\"%s\":%llu", i ? "," : "", Perf_PhaseName((PERF_PHASE)i),
+                        (unsigned long long)t.PhaseMs[i]);
+    }
+    ok = ok && appendJson(buf, size, pos, "},\"refreshes\":{");
+    for (int i = 0; ok && i < PERF_REFRESH_COUNT; i++) {
+        ok = appendJson(buf, size, pos, "%s\"%s\":%u", i ? "," : "", Perf_RefreshName((PERF_REFRESH)i),
+                        (unsigned)t.Refreshes[i]);
+    }
+    ok = ok && appendJson(buf, size, pos, "},\"fields\":[\"time\",\"awake_ms\"");
+    for (int i = 0; ok && i < PERF_PHASE_COUNT; i++) {
+        ok = appendJson(buf, size, pos, ",\"%s_ms\"", Perf_PhaseName((PERF_PHASE)i));
+    }
+    ok = ok && appendJson(buf, size, pos, ",\"battery_mv\"");
+    for (int i = 0; ok && i < PERF_REFRESH_COUNT; i++) {
+        ok = appendJson(buf, size, pos, ",\"%s\"", Perf_RefreshName((PERF_REFRESH)i));
+    }
+    ok = ok && appendJson(buf, size, pos, "],\"rows\":[");
+    for (uint16_t c = 0; ok && c < count; c++) {
+        const PERF_CYCLE &cycle = cycles[c];
+        ok = appendJson(buf, size, pos, "%s[%u,%u", c ? "," : "", (unsigned)cycle.Time, (unsigned)cycle.AwakeMs);
+        for (int i = 0; ok && i < PERF_PHASE_COUNT; i++) {
+            ok = appendJson(buf, size, pos, ",%u", (unsigned)cycle.PhaseMs[i]);
+        }
+        ok = ok && appendJson(buf, size, pos, ",%u", (unsigned)cycle.BatteryMv);
+        for (int i = 0; ok && i < PERF_REFRESH_COUNT; i++) {
+            ok = appendJson(buf, size, pos, ",%u", (unsigned)cycle.Refreshes[i]);
+        }
+        ok = ok && appendJson(buf, size, pos, "]");
+    }
+    ok = ok && appendJson(buf, size, pos, "]}");
+    return ok ? pos : 0;
+}
 
-        if (WiFi.status() == WL_CONNECTED) {
-            Serial.println("Beginning of a new hour detected. Syncing time...");
-            if (syncTime()) {   // Perform the time sync
-                updateDisplay(); // Update the display immediately after sync
-            }
+// One POST with everything pending, dropped from RTC memory once accepted
+void uploadTelemetry() {
+    if (telemetryUrl[0] == '\0' || WiFi.status() != WL_CONNECTED) {
+        return;
+    }
+    PerfScope timer(PERF_POST);
+    const size_t bodySize = 1024 + PERF_CYCLE_SLOTS * (24 + 6 * (PERF_PHASE_COUNT + PERF_REFRESH_COUNT + 1));
+    PERF_TELEMETRY totals;
+    PERF_CYCLE *cycles = (PERF_CYCLE *)malloc(PERF_CYCLE_SLOTS * sizeof(PERF_CYCLE));
+    char *body = (char *)malloc(bodySize);
+    if (!cycles || !body) {
+        Serial.println("Failed to allocate telemetry buffers.");
+        free(cycles);
+        free(body);
+        return;
+    }
+
+    uint16_t count = Perf_SnapshotTelemetry(&totals, cycles, PERF_CYCLE_SLOTS);
+    size_t len = formatTelemetry(body, bodySize, totals, cycles, count);
+    if (len > 0 && totals.Cycles > 0) {
+        HTTPClient http;
+        http.setTimeout(5000);
+        int status = -1;
+        if (http.begin(telemetryUrl)) {
+            http.addHeader("Content-Type", "application/json");
+            status = http.POST((uint8_t *)body, len);
+            http.end();
+        }
+        if (status >= 200 && status < 300) {
+            Perf_TelemetrySent(&totals, count);
+            Serial.printf("Telemetry posted (%u cycles, %u bytes).\n", (unsigned)totals.Cycles, (unsigned)len);
         } else {
-            Serial.println("WiFi not connected. Cannot synchronize time.");
+            Serial.printf("Telemetry upload failed (%d), kept for the next sync.\n", status);
         }
     }
+    free(cycles);
+    free(body);
 }
 
 // --------------------------------------------------------------------
-// Setup
+// 8) Check for time sync at the beginning of each new hour
+//    (or once the adaptive interval has passed)
 // --------------------------------------------------------------------
-void setup() {
-    Serial.begin(115200);
-    delay(1000); // Allow time for Serial to initialize
+bool timeSyncDue(const struct tm &timeinfo) {
+    if (useAdaptiveSync) {
+        int64_t nowMs = epochMillis();
+        return nowMs >= syncRetryMs && (lastSyncMs == 0 || nowMs - lastSyncMs >= (int64_t)syncIntervalSec * 1000);
+    }
+    return timeinfo.tm_hour != lastSyncedHour;
+}
+
+// Adaptive mode: bring WiFi up for the sync only
+bool syncTimeOverWiFi() {
+    if (WiFi.status() != WL_CONNECTED) {
+        initWiFi();
+    }
+    bool synced = WiFi.status() == WL_CONNECTED && syncTime();
+    uploadTelemetry();
+    stopWiFi();
+    return synced;
+}
 
-    // Initialize WiFi
-    initWiFi();
+// True if a sync ran and succeeded
+bool syncTimeIfDue() {
+    correctClockDrift();
 
-    // Initialize Time
-    if (!syncTime()) {
-        Serial.println("Initial time synchronization failed. Continuing without accurate time.");
-        // Optionally, handle this scenario (e.g., retry, use fallback time, etc.)
+    struct tm timeinfo;
+    if (!getLocalTime(&timeinfo)) {
+        Serial.println("Failed to retrieve current time.");
+        return false;
     }
 
-    // Initialize e-Paper Module
-    DEV_Module_Init();
-    EPD_3IN52B_Init();
-    EPD_3IN52B_Clear();
-    DEV_Delay_ms(1000);
-
-    // Allocate memory for e-Paper buffers
-    UWORD Imagesize = ((EPD_3IN52B_WIDTH % 8 == 0) 
-                        ? (EPD_3IN52B_WIDTH / 8) 
-                        : (EPD_3IN52B_WIDTH / 8 + 1)) 
-                        * EPD_3IN52B_HEIGHT;
+    if (!timeSyncDue(timeinfo)) {
+        return false;
+    }
+    lastSyncedHour = timeinfo.tm_hour;  // Update the last synced hour
+
+    if (useAdaptiveSync) {
+        Serial.println("Sync interval elapsed. Syncing time...");
+        if (syncTimeOverWiFi()) {
+            return true;
+        }
+        syncRetryMs = epochMillis() + 15 * 60000L;
+        return false;
+    }
+
+    if (WiFi.status() == WL_CONNECTED) {
+        Serial.println("Beginning of a new hour detected. Syncing time...");
+        bool synced = syncTime();   // Perform the time sync
+        uploadTelemetry();
+        return synced;
+    } else {
+        Serial.println("WiFi not connected. Cannot synchronize time.");
+    }
+    return false;
+}
+
+void checkTimeSync() {
+    if (syncTimeIfDue()) {
+        updateDisplay(); // Update the display immediately after sync
+    }
+}
+
+// --------------------------------------------------------------------
+// 9) Deep-sleep scheduler
+// --------------------------------------------------------------------
+void allocateFrameBuffers() {
+    UWORD Imagesize = imageSize();
     BlackImage = (UBYTE *)malloc(Imagesize);
     RedImage   = (UBYTE *)malloc(Imagesize);
-    if (!BlackImage || !RedImage) {
+    PrevBlackImage = (UBYTE *)malloc(Imagesize);
+    PrevRedImage   = (UBYTE *)malloc(Imagesize);
+    if ((usePipelinedRender || useTaskSplit) && !useDeepSleep) {
+        NextBlackImage = (UBYTE *)malloc(Imagesize);
+        NextRedImage   = (UBYTE *)malloc(Imagesize);
+        if (!NextBlackImage || !NextRedImage) {
+            Serial.println("Failed to allocate next-frame buffers");
+            while (true); // Halt execution
+        }
+    }
+    if (!BlackImage || !RedImage || !PrevBlackImage || !PrevRedImage) {
         Serial.println("Failed to allocate memory for images");
         while (true); // Halt execution
     }
@@ -343,6 +1420,343 @@ void setup() {
     Paint_NewImage(RedImage, EPD_3IN52B_WIDTH, EPD_3IN52B_HEIGHT, 90, WHITE);
     Paint_SelectImage(RedImage);
     Paint_Clear(WHITE);
+}
+
+// Recreate the TZ setting configTime() derives from the offsets, the
+// environment does not survive deep sleep but the RTC time does
+void formatUtcOffset(char *buf, size_t len, const char *name, long offset) {
+    if (offset % 3600) {
+        snprintf(buf, len, "%s%ld:%02ld", name, offset / 3600, labs(offset % 3600) / 60);
+    } else {
+        snprintf(buf, len, "%s%ld", name, offset / 3600);
+    }
+}
+
+void applyTimeZone() {
+    char cst[17];
+    char cdt[17] = "DST";
+    char tz[34];
+    formatUtcOffset(cst, sizeof(cst), "UTC", -gmtOffset_sec);
+    if (daylightOffset_sec != 3600) {
+        formatUtcOffset(cdt, sizeof(cdt), "DST", -gmtOffset_sec - daylightOffset_sec);
+    }
+    snprintf(tz, sizeof(tz), "%s%s", cst, cdt);
+    setenv("TZ", tz, 1);
+    tzset();
+}
+
+// Rebuild the copy of the frame on the panel so the first update after a
+// wake can still be a partial one. Only trusted if its fingerprint matches.
+void restoreShownFrame() {
+    if (!shownFrameCrcValid || shownFrameTime == 0) {
+        return;
+    }
+    struct tm shown;
+    localtime_r(&shownFrameTime, &shown);
+
+    bool rendered = renderFrameForTime(shown, PrevBlackImage, PrevRedImage);
+
+    prevFrameValid = rendered && frameFingerprint(PrevBlackImage, PrevRedImage) == shownFrameCrc;
+    Paint_ResetDirty();
+}
+
+// Put the panel and the ESP32 to sleep until just after the next minute boundary
+void enterDeepSleep() {
+    long sleepMs = 60000L;
+    struct tm now;
+    if (getLocalTime(&now, 0)) {
+        unsigned long untilBoundary = millisUntilNextMinute(now);
+        scheduledWakeMs = epochMillis() + untilBoundary + wakeGuardMs;
+        sleepMs = (long)untilBoundary + wakeGuardMs - wakeLatencyMs;
+        if (sleepMs < 10) sleepMs = 10;
+    }
+
+    Serial.print("Going to deep sleep for ");
+    Serial.print(sleepMs);
+    Serial.println(" milliseconds...");
+    EPD_3IN52B_sleep();
+    stopWiFi();
+    endTelemetryCycle();
+    Serial.flush();
+
+    esp_sleep_enable_timer_wakeup((uint64_t)sleepMs * 1000ULL);
+    esp_deep_sleep_start();
+}
+
+// Timer wake with a trusted RTC: skip initWiFi()/syncTime() unless the hourly
+// sync is due, draw the new minute and go straight back to sleep
+void resumeFromDeepSleep() {
+    applyTimeZone();
+    correctClockDrift(); // Every wake, not only those a sync is due on
+
+    // Boot time shows up as lateness, fold it into the next sleep
+    long lateMs = (long)(epochMillis() - scheduledWakeMs);
+    wakeLatencyMs = constrain(wakeLatencyMs + lateMs / 2, 0L, 3000L);
+    if (lateMs < 0) {
+        delay(-lateMs); // Woke before the boundary
+    }
+
+    DEV_Module_Init();
+    EPD_3IN52B_Init();
+    allocateFrameBuffers();
+    restoreShownFrame();
+
+    struct tm now;
+    if (getLocalTime(&now, 0) && timeSyncDue(now)) {
+        if (!useAdaptiveSync) {
+            initWiFi();
+        }
+        checkTimeSync();
+    }
+    updateDisplay();
+    Perf_PollSerial();
+    enterDeepSleep();
+}
+
+// Whether rtcState (loaded: rtcStateKept), the RTC time and the panel survived the reset
+bool isWarmBoot(bool rtcStateKept) {
+    if (!useWarmBoot || !rtcStateKept || !rtcTimeTrusted) {
+        return false;
+    }
+    switch (esp_reset_reason()) {
+    case ESP_RST_DEEPSLEEP:
+    case ESP_RST_BROWNOUT:
+    case ESP_RST_SW:
+    case ESP_RST_PANIC:
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+        break;
+    default:
+        return false;
+    }
+    applyTimeZone();
+    struct tm now;
+    return getLocalTime(&now, 0);
+}
+
+// setup() after a warm reset: no clear, the first frame is diffed against the
+// one still on the panel and refreshes while a due time sync runs
+void warmBoot() {
+    Serial.println("Warm boot, showing the current minute.");
+    correctClockDrift();
+    DEV_Module_Init();
+    EPD_3IN52B_Init();
+    allocateFrameBuffers();
+    restoreShownFrame();
+
+    waitForRefresh = false;
+    updateDisplay();
+    waitForRefresh = true;
+
+    struct tm now;
+    bool syncDue = getLocalTime(&now, 0) && timeSyncDue(now);
+    // Up between the hourly syncs as after a cold boot, unless deep sleeping
+    if (!useAdaptiveSync && (syncDue || !useDeepSleep)) {
+        initWiFi();
+    }
+    if (syncDue) {
+        checkTimeSync();
+    }
+    waitPanelIdle();
+}
+
+// --------------------------------------------------------------------
+// 10) Pipelined rendering
+// --------------------------------------------------------------------
+// Draw the frame for an upcoming minute into the Next buffers
+bool prepareFrame(time_t minute) {
+    struct tm next;
+    localtime_r(&minute, &next);
+    bool rendered = renderFrameForTime(next, NextBlackImage, NextRedImage);
+    nextFrameTime = rendered ? minute : 0;
+    return rendered;
+}
+
+// Make the prepared frame current and send it to the panel. Nothing else draws
+// between prepareFrame() and here, so Paint's dirty region still covers it.
+void commitFrame() {
+    std::swap(BlackImage, NextBlackImage);
+    std::swap(RedImage, NextRedImage);
+    renderedFrameTime = nextFrameTime;
+    nextFrameTime = 0;
+    presentFrame();
+}
+
+// One loop() iteration in pipelined mode: render ahead, wait, show
+void runPipelinedMinute() {
+    Perf_PollSerial();
+    int64_t targetMs = ((epochMillis() + refreshLeadMs) / 60000 + 1) * 60000;
+    bool ready = prepareFrame((time_t)(targetMs / 1000));
+    if (!ready) {
+        Serial.println("Next verse data is empty, drawing at the boundary.");
+    }
+
+    int64_t waitMs = targetMs - (ready ? refreshLeadMs : 0) - epochMillis();
+    Serial.print("Next frame ");
+    Serial.print(ready ? "ready" : "not ready");
+    Serial.print(", waiting ");
+    Serial.print((long)max(waitMs, (int64_t)0));
+    Serial.println(" milliseconds...");
+    if (waitMs > 0) {
+        delay(waitMs);
+    }
+
+    if (ready) {
+        commitFrame();
+        if (logHeapStats) {
+            reportHeap();
+        }
+    } else {
+        updateDisplay();
+    }
+    checkTimeSync();
+    endTelemetryCycle();
+}
+
+// --------------------------------------------------------------------
+// 11) Task split
+// --------------------------------------------------------------------
+bool taskSplitActive() {
+    return useTaskSplit && usePipelinedRender && !useDeepSleep;
+}
+
+// Renderer: draws each upcoming minute into the Next buffers once the panel
+// task has taken the previous frame
+void renderTask(void *) {
+    int64_t lastTargetMs = 0;
+    for (;;) {
+        xSemaphoreTake(nextBuffersFree, portMAX_DELAY);
+        struct tm now;
+        while (!getLocalTime(&now, 0)) {
+            vTaskDelay(pdMS_TO_TICKS(1000)); // No time yet, the net task is on it
+        }
+
+        // The panel hands the buffers back right at (boundary - lead), so
+        // never aim at the minute just taken
+        int64_t targetMs = ((epochMillis() + refreshLeadMs) / 60000 + 1) * 60000;
+        if (targetMs <= lastTargetMs) {
+            targetMs = lastTargetMs + 60000;
+        }
+        lastTargetMs = targetMs;
+
+        FrameMessage msg;
+        msg.minute = (time_t)(targetMs / 1000);
+        struct tm next;
+        localtime_r(&msg.minute, &next);
+        Paint_ResetDirty();
+        if (!renderFrameForTime(next, NextBlackImage, NextRedImage) || !Paint_GetDirtyRect(&msg.dirty)) {
+            Serial.println("Next verse data is empty. Skipping display.");
+            int64_t waitMs = targetMs - epochMillis();
+            if (waitMs > 0) {
+                vTaskDelay(pdMS_TO_TICKS(waitMs));
+            }
+            xSemaphoreGive(nextBuffersFree);
+            continue;
+        }
+        xQueueSend(frameQueue, &msg, portMAX_DELAY);
+    }
+}
+
+// Panel I/O: waits for the frame's minute, swaps it in and refreshes
+void panelTask(void *) {
+    FrameMessage msg;
+    for (;;) {
+        xQueueReceive(frameQueue, &msg, portMAX_DELAY);
+
+        // Re-check in steps, an NTP sync may move the clock meanwhile
+        int64_t dueMs = (int64_t)msg.minute * 1000 - refreshLeadMs;
+        int64_t waitMs;
+        while ((waitMs = dueMs - epochMillis()) > 0) {
+            vTaskDelay(pdMS_TO_TICKS(min(waitMs, (int64_t)1000)));
+        }
+        if (epochMillis() >= (int64_t)msg.minute * 1000 + 60000) {
+            Serial.println("Frame is stale after a clock change. Dropping it.");
+            xSemaphoreGive(nextBuffersFree);
+            continue;
+        }
+
+        std::swap(BlackImage, NextBlackImage);
+        std::swap(RedImage, NextRedImage);
+        xSemaphoreGive(nextBuffersFree); // Renderer may start on the next minute during the refresh
+        showFrame(msg.dirty, msg.minute);
+        endTelemetryCycle();
+        if (logHeapStats) {
+            reportHeap();
+        }
+    }
+}
+
+// Network: keeps the clock synced (and WiFi up unless the adaptive sync
+// switches it off in between), never touches the panel
+void netTask(void *) {
+    for (;;) {
+        if (!useAdaptiveSync && WiFi.status() != WL_CONNECTED) {
+            initWiFi();
+        }
+        struct tm now;
+        if (!getLocalTime(&now, 0)) {
+            if (useAdaptiveSync) {
+                syncTimeOverWiFi(); // Boot without time, retry until it works
+            } else if (WiFi.status() == WL_CONNECTED) {
+                syncTime();
+            }
+        } else {
+            syncTimeIfDue();
+        }
+        Perf_PollSerial();
+        vTaskDelay(pdMS_TO_TICKS(netCheckIntervalMs));
+    }
+}
+
+void startTasks() {
+    frameQueue = xQueueCreate(1, sizeof(FrameMessage));
+    nextBuffersFree = xSemaphoreCreateBinary();
+    xSemaphoreGive(nextBuffersFree);
+    xTaskCreatePinnedToCore(panelTask, "panel", 4096, NULL, 3, NULL, 1);
+    xTaskCreatePinnedToCore(renderTask, "render", 8192, NULL, 2, NULL, 1);
+    xTaskCreatePinnedToCore(netTask, "net", 6144, NULL, 1, NULL, 0);
+}
+
+// --------------------------------------------------------------------
+// Setup
+// --------------------------------------------------------------------
+void setup() {
+    Serial.begin(115200);
+    bool rtcStateKept = loadRtcState();
+    if (useDeepSleep && rtcTimeTrusted && esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER) {
+        resumeFromDeepSleep(); // Does not return
+    }
+    bool warm = isWarmBoot(rtcStateKept);
+
+    if (warm) {
+        warmBoot();
+    } else {
+        delay(1000); // Allow time for Serial to initialize
+
+        // Initialize WiFi
+        initWiFi();
+
+        // Initialize Time
+        if (!syncTime()) {
+            Serial.println("Initial time synchronization failed. Continuing without accurate time.");
+            // Optionally, handle this scenario (e.g., retry, use fallback time, etc.)
+        }
+        if (useAdaptiveSync) {
+            stopWiFi(); // Back on for the next sync only
+        }
+
+        // Initialize e-Paper Module
+        DEV_Module_Init();
+        EPD_3IN52B_Init();
+        EPD_3IN52B_Clear();
+        shownFrameCrcValid = false;  // Panel is blank now
+        sealRtcState();
+        DEV_Delay_ms(1000);
+
+        // Allocate memory for e-Paper buffers
+        allocateFrameBuffers();
+    }
 
     // Retrieve current time
     struct tm currentTime;
@@ -351,25 +1765,48 @@ void setup() {
       displayContent("0:00", "WiFi Error", "Display will not update until time is synchronized.");
     } else {
         unsigned long currentMs = millis();
-        checkTimeSync();
-        updateDisplay();
-        unsigned long timeElapsedMs = millis() - currentMs;        
-        // Calculate milliseconds until the next minute starts
-        unsigned long initialDelay = millisUntilNextMinute(currentTime) - timeElapsedMs;
-        // Wait until one second after the next minute before the first regular update
-        delay(initialDelay + 1000UL);
-        updateDisplay();
+        if (!warm) {
+            checkTimeSync();
+            updateDisplay();
+        }
+        if (useDeepSleep) {
+            enterDeepSleep(); // Does not return
+        }
+        // In pipelined mode loop() renders ahead and waits for the boundary itself
+        if (!usePipelinedRender) {
+            unsigned long timeElapsedMs = millis() - currentMs;
+            // Calculate milliseconds until the next minute starts
+            unsigned long initialDelay = millisUntilNextMinute(currentTime) - timeElapsedMs;
+            // Wait until one second after the next minute before the first regular update
+            delay(initialDelay + 1000UL);
+            updateDisplay();
+        }
     }
 
     // Initialize timing variables
     previousDisplayUpdateMillis = millis();
     previousTimeSyncMillis = millis();
+
+    if (taskSplitActive()) {
+        startTasks();
+    }
 }
 
 // --------------------------------------------------------------------
 // Loop
 // --------------------------------------------------------------------
 void loop() {
+    if (taskSplitActive()) {
+        vTaskDelete(NULL); // The tasks started in setup() do the work
+    }
+
+    struct tm now;
+    if (usePipelinedRender && !useDeepSleep && getLocalTime(&now, 0)) {
+        runPipelinedMinute();
+        return;
+    }
+
+    Perf_PollSerial();
     unsigned long currentMs = millis();
 
     // Check for time sync at the start of the hour
@@ -378,6 +1815,11 @@ void loop() {
     // Update display
     updateDisplay();
 
+    if (useDeepSleep) {
+        enterDeepSleep(); // Does not return
+    }
+    endTelemetryCycle();
+
     // Measure elapsed time
     unsigned long timeElapsedMs = millis() - currentMs;
     unsigned long remainingMs = displayUpdateIntervalMs - timeElapsedMs;
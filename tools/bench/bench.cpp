@@ -0,0 +1,235 @@
+// Host benchmark of the clock face drawing code.
+//
+// Renders the frame of every minute of the day from the binary verse index
+// (data/verses.bin, written by parser.py) through VerseRender_Frame(), the
+// same code renderContent()/renderFrameForTime() run on the device, and
+// reports ns/frame, heap allocations and a digest of all frames. A changed
+// digest means the output changed; with a snapshot directory every frame is
+// written as a PBM (as seen on the panel, black and red ink both black) for
+// diffing.
+//
+// Built and run by the native environment:
+//
+//   pio run -e native && .pio/build/native/program [data/verses.bin] [passes] [snapshot dir]
+//
+// or by hand from the repository root:
+//
+//   g++ -O2 -std=gnu++17 -Iinclude -Itools/host -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free
+//       -o bench tools/bench/bench.cpp src/VerseRender.cpp src/GUI_Paint.cpp src/font*.cpp
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "VerseRender.h"
+
+static const int slotCount = 24 * 60;
+
+// Allocation counter: operator new everywhere, malloc & co. in the objects
+// linked with --wrap (the drawing code itself)
+static unsigned long allocations = 0;
+
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *p, size_t size);
+void __real_free(void *p);
+
+void *__wrap_malloc(size_t size)
+{
+    allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size)
+{
+    allocations++;
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *p, size_t size)
+{
+    allocations++;
+    return __real_realloc(p, size);
+}
+
+void __wrap_free(void *p)
+{
+    __real_free(p);
+}
+}
+
+void *operator new(size_t size)
+{
+    allocations++;
+    if (void *p = __real_malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    __real_free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    __real_free(p);
+}
+
+struct Slot {
+    char time[6];
+    char bookName[256];
+    const char *text;  // NULL = no verse for this minute
+};
+
+static bool readFile(const char *path, std::vector<uint8_t> &data)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    data.resize(ftell(f));
+    fseek(f, 0, SEEK_SET);
+    bool ok = fread(data.data(), 1, data.size(), f) == data.size();
+    fclose(f);
+    return ok;
+}
+
+static uint32_t get32(const std::vector<uint8_t> &in, size_t pos)
+{
+    return in[pos] | (in[pos + 1] << 8) | (in[pos + 2] << 16) | ((uint32_t)in[pos + 3] << 24);
+}
+
+// FNV-1a over both planes of every frame
+static uint64_t digest(uint64_t h, const UBYTE *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ data[i]) * 0x100000001B3ULL;
+    }
+    return h;
+}
+
+// 360x240 as seen on the panel, ink where either plane is 0
+static bool writePbm(const char *path, const UBYTE *black, const UBYTE *red, UWORD widthByte)
+{
+    const int width = EPD_3IN52B_HEIGHT, height = EPD_3IN52B_WIDTH;
+    const int rowBytes = (width + 7) / 8;
+    std::vector<uint8_t> out(rowBytes * height, 0);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            // ROTATE_90: screen (x, y) is memory (WidthMemory - y - 1, x)
+            int memX = EPD_3IN52B_WIDTH - y - 1, memY = x;
+            size_t addr = memX / 8 + (size_t)memY * widthByte;
+            UBYTE bit = 0x80 >> (memX % 8);
+            if (!(black[addr] & bit) || !(red[addr] & bit)) {
+                out[y * rowBytes + x / 8] |= 0x80 >> (x % 8);
+            }
+        }
+    }
+
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        return false;
+    }
+    fprintf(f, "P4\n%d %d\n", width, height);
+    bool ok = fwrite(out.data(), 1, out.size(), f) == out.size();
+    fclose(f);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    const char *indexPath = argc > 1 ? argv[1] : "data/verses.bin";
+    int passes = argc > 2 ? atoi(argv[2]) : 5;
+    const char *snapshotDir = argc > 3 ? argv[3] : NULL;
+    if (passes < 1) {
+        passes = 1;
+    }
+
+    std::vector<uint8_t> index;
+    if (!readFile(indexPath, index) || index.size() < 16 + slotCount * 8 ||
+        memcmp(index.data(), "BVRS", 4) != 0 ||
+        (index[4] | (index[5] << 8)) != 1 || (index[6] | (index[7] << 8)) != slotCount) {
+        fprintf(stderr, "%s: not a verse index (run parser.py index data)\n", indexPath);
+        return 1;
+    }
+
+    // Same lookup as readVerseFromIndex()/getCurrentVerseData(), done up front
+    // so only drawing is timed
+    std::vector<Slot> slots(slotCount);
+    int verses = 0;
+    for (int slot = 0; slot < slotCount; slot++) {
+        size_t entry = 16 + slot * 8;
+        uint32_t offset = get32(index, entry);
+        uint16_t refLen = index[entry + 4] | (index[entry + 5] << 8);
+        uint16_t textLen = index[entry + 6] | (index[entry + 7] << 8);
+        Slot &s = slots[slot];
+        snprintf(s.time, sizeof(s.time), "%02d:%02d", slot / 60, slot % 60);
+        s.text = NULL;
+        if (textLen == 0 || offset >= index.size() ||
+            (size_t)refLen + 1 + textLen + 1 > index.size() - offset) {
+            continue;
+        }
+        VerseRender_BookName((const char *)&index[offset], s.bookName, sizeof(s.bookName));
+        s.text = (const char *)&index[offset + refLen + 1];
+        verses++;
+    }
+
+    const UWORD widthByte = (EPD_3IN52B_WIDTH % 8 == 0) ? (EPD_3IN52B_WIDTH / 8) : (EPD_3IN52B_WIDTH / 8 + 1);
+    const size_t planeSize = (size_t)widthByte * EPD_3IN52B_HEIGHT;
+    std::vector<UBYTE> black(planeSize), red(planeSize);
+    Paint_NewImage(black.data(), EPD_3IN52B_WIDTH, EPD_3IN52B_HEIGHT, 90, WHITE);
+    Paint_NewImage(red.data(), EPD_3IN52B_WIDTH, EPD_3IN52B_HEIGHT, 90, WHITE);
+
+    double bestNs = 0;
+    unsigned long drawAllocations = 0;
+    uint64_t frameDigest = 0;
+    for (int pass = 0; pass < passes; pass++) {
+        uint64_t h = 0xCBF29CE484222325ULL;
+        unsigned long passAllocations = 0;
+        std::chrono::nanoseconds elapsed(0);
+        for (int slot = 0; slot < slotCount; slot++) {
+            const Slot &s = slots[slot];
+            if (!s.text) {
+                continue;
+            }
+            unsigned long before = allocations;
+            auto start = std::chrono::steady_clock::now();
+            VerseRender_Frame(black.data(), red.data(), s.time, s.bookName, s.text);
+            elapsed += std::chrono::steady_clock::now() - start;
+            passAllocations += allocations - before;
+
+            h = digest(h, black.data(), planeSize);
+            h = digest(h, red.data(), planeSize);
+            if (pass == 0 && snapshotDir) {
+                char path[512];
+                snprintf(path, sizeof(path), "%s/%.2s%.2s.pbm", snapshotDir, s.time, s.time + 3);
+                if (!writePbm(path, black.data(), red.data(), widthByte)) {
+                    fprintf(stderr, "%s: write failed\n", path);
+                    return 1;
+                }
+            }
+        }
+        if (pass == 0) {
+            drawAllocations = passAllocations;
+            frameDigest = h;
+        } else if (h != frameDigest) {
+            fprintf(stderr, "Pass %d drew different frames\n", pass + 1);
+            return 1;
+        }
+        double ns = (double)elapsed.count() / verses;
+        if (pass == 0 || ns < bestNs) {
+            bestNs = ns;
+        }
+    }
+
+    printf("%d frames x %d passes: %.0f ns/frame (best pass), %.2f allocations/frame\n",
+           verses, passes, bestNs, (double)drawAllocations / verses);
+    printf("frame digest %016llx\n", (unsigned long long)frameDigest);
+    return 0;
+}
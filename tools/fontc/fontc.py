@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+
+"""
+Compile a bitmap font table (the STM32 LCD font generator's output, kept in
+fonts/) into the column-span form Paint_DrawChar() blits directly.
+
+    python tools/fontc/fontc.py fonts/font24.cpp src/font24.cpp
+    python tools/fontc/fontc.py fonts/font32.cpp src/font32.cpp --chars "0123456789:"
+
+Each glyph is stored column by column (left to right). A column is a list of
+vertical ink runs, top to bottom, closed by 0x00:
+
+    0xGL        run of L (1..15) pixels starting G (0..15) rows below the
+                end of the previous run (or the top of the glyph)
+    0xF0 G L    the same with full-byte G and L, for gaps or runs past 15
+    0x00        end of column
+
+With ROTATE_90 a glyph column is one memory row, so a run becomes a masked
+byte fill and no bit has to be tested. The per-glyph offset table
+(<Name>_SpanIndex) covers FirstChar..FirstChar+CharCount-1. --chars keeps only
+the given characters (others in that range compile to empty glyphs), e.g.
+Font32 is only used for the time.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+FIRST_CHAR = ord(' ')
+MAX_HEIGHT = 32  # Paint_DrawChar() keeps a glyph column in 32 bits
+
+
+def load_bitmap_font(path):
+    with open(path, newline='') as f:
+        source = f.read()
+    name = re.search(r'sFONT\s+(\w+)\s*=', source).group(1)
+    width = int(re.search(r'(\d+),\s*/\*\s*Width', source).group(1))
+    height = int(re.search(r'(\d+),\s*/\*\s*Height', source).group(1))
+
+    table = re.search(r'_Table\s*\[\]\s*=\s*\{(.*?)\};', source, re.S).group(1)
+    table = re.sub(r'/\*.*?\*/', '', table, flags=re.S)
+    table = re.sub(r'//[^\n]*', '', table)
+    data = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', table)]
+
+    row_bytes = (width + 7) // 8
+    glyph_size = row_bytes * height
+    if len(data) % glyph_size:
+        sys.exit('%s: table size %d is not a multiple of %d' % (path, len(data), glyph_size))
+
+    glyphs = []
+    for g in range(len(data) // glyph_size):
+        bitmap = data[g * glyph_size:(g + 1) * glyph_size]
+        columns = []
+        for c in range(width):
+            columns.append([(bitmap[r * row_bytes + c // 8] >> (7 - c % 8)) & 1 for r in range(height)])
+        glyphs.append(columns)
+    return name, width, height, glyphs, len(data)
+
+
+def encode_column(column):
+    out = []
+    row, prev_end = 0, 0
+    while row < len(column):
+        if not column[row]:
+            row += 1
+            continue
+        start = row
+        while row < len(column) and column[row]:
+            row += 1
+        gap, length = start - prev_end, row - start
+        if gap < 16 and 0 < length < 16:
+            out.append(gap << 4 | length)
+        else:
+            out += [0xF0, gap, length]
+        prev_end = row
+    out.append(0x00)
+    return out
+
+
+def ascii_art(column):
+    return ''.join('#' if px else '.' for px in column)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    ap.add_argument('input', help='bitmap font source (fonts/fontNN.cpp)')
+    ap.add_argument('output', help='span font source to write (src/fontNN.cpp)')
+    ap.add_argument('--chars', help='only these characters (default: all)')
+    args = ap.parse_args()
+
+    name, width, height, glyphs, bitmap_bytes = load_bitmap_font(args.input)
+    if height > MAX_HEIGHT:
+        sys.exit('%s: %d rows, at most %d supported' % (args.input, height, MAX_HEIGHT))
+
+    codes = range(FIRST_CHAR, FIRST_CHAR + len(glyphs))
+    if args.chars:
+        wanted = sorted(set(ord(ch) for ch in args.chars))
+        if any(code not in codes for code in wanted):
+            sys.exit('--chars: characters outside %r..%r' % (chr(codes[0]), chr(codes[-1])))
+        codes = range(wanted[0], wanted[-1] + 1)
+    else:
+        wanted = list(codes)
+
+    spans, index, blocks = [], [], []
+    empty = None
+    for code in codes:
+        if code not in wanted:
+            # Shared empty glyph for the gaps of a subset
+            if empty is None:
+                empty = len(spans)
+                encoded = [0x00] * width
+                spans += encoded
+                blocks.append((empty, '(empty)', encoded, None))
+            index.append(empty)
+            continue
+        index.append(len(spans))
+        columns = glyphs[code - FIRST_CHAR]
+        encoded = [encode_column(column) for column in columns]
+        blocks.append((len(spans), repr(chr(code)), encoded, columns))
+        spans += [b for column in encoded for b in column]
+
+    if len(spans) > 0xFFFF:
+        sys.exit('%s: %d span bytes do not fit the 16-bit index' % (args.input, len(spans)))
+
+    out = []
+    out.append('/**')
+    out.append(' * %s (%dx%d) as column spans, see tools/fontc/fontc.py' % (name, width, height))
+    out.append(' * Compiled from %s, do not edit.' % os.path.relpath(args.input).replace(os.sep, '/'))
+    if args.chars:
+        out.append(' * Characters: %s' % ''.join(chr(c) for c in wanted))
+    out.append(' */')
+    out.append('#include <stddef.h>')
+    out.append('#include "fonts.h"')
+    out.append('')
+    out.append('// %d bytes (bitmap table: %d)' % (len(spans) + 2 * len(index), bitmap_bytes))
+    out.append('const uint8_t %s_Spans[] = {' % name)
+    for offset, label, encoded, columns in blocks:
+        out.append('    // @%d %s' % (offset, label))
+        for c, column in enumerate(encoded):
+            art = ' /* |%s| */' % ascii_art(columns[c]) if columns else ''
+            out.append('    %s,%s' % (', '.join('0x%02X' % b for b in column), art))
+    out.append('};')
+    out.append('')
+    out.append('const uint16_t %s_SpanIndex[] = {' % name)
+    for i in range(0, len(index), 12):
+        out.append('    %s,' % ', '.join(str(v) for v in index[i:i + 12]))
+    out.append('};')
+    out.append('')
+    out.append('sFONT %s = {' % name)
+    out.append('    NULL,')
+    out.append('    %d, /* Width */' % width)
+    out.append('    %d, /* Height */' % height)
+    out.append('    %s_Spans,' % name)
+    out.append('    %s_SpanIndex,' % name)
+    out.append('    0x%02X, /* FirstChar */' % codes[0])
+    out.append('    %d, /* CharCount */' % len(codes))
+    out.append('};')
+
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+    print('%s: %d glyphs, %d bytes (bitmap table: %d)' % (name, len(codes), len(spans) + 2 * len(index), bitmap_bytes))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,28 @@
+// Minimal Arduino stand-in for building the drawing code (GUI_Paint, fonts,
+// VerseRender) on the host. Not a HAL: nothing here drives the panel.
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define LOW    0
+#define HIGH   1
+#define INPUT  0
+#define OUTPUT 1
+
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline int digitalRead(int) { return LOW; }
+inline void delay(unsigned long) {}
+
+struct HostSerial {
+    void print(const char *s) { fputs(s, stderr); }
+    void print(int v) { fprintf(stderr, "%d", v); }
+    void println(const char *s) { fprintf(stderr, "%s\n", s); }
+};
+inline HostSerial Serial;
+
+#endif
@@ -0,0 +1 @@
+// Debug.h pulls in Wire.h, the host build has no I2C
@@ -0,0 +1,166 @@
+// Pre-render the verse plane of every minute of the day on the host.
+//
+// Reads the binary verse index written by parser.py (data/verses.bin), draws
+// each verse with the firmware's own GUI_Paint/VerseRender code and stores the
+// black plane raw-deflated, ready to be flashed into the "frames" partition of
+// the esp32dev_frames environment (partitions_frames.csv). Only the verse is
+// stored; the time and book name on the red plane are still drawn on the device.
+//
+// Build and run from the repository root:
+//
+//   g++ -O2 -std=gnu++17 -Iinclude -Itools/host -o prerender tools/prerender/prerender.cpp
+//       src/VerseRender.cpp src/GUI_Paint.cpp src/font*.cpp -lz
+//   ./prerender data/verses.bin frames.bin
+//
+// Little-endian layout, one slot per minute of the day (slot = hour*60 + minute):
+//
+//   header  16 bytes    magic "BVFR", u16 version, u16 slot count (1440),
+//                       u32 plane size in bytes, u32 total image size
+//   table   1440 * 12   u32 offset of the deflate stream, u32 compressed length
+//                       (0 = no frame), u32 crc32 of verse text + has-book byte
+//   data                raw deflate (no zlib header) streams
+//
+// The crc lets the firmware reject frames that were drawn from a different
+// verse than the one it just read, e.g. after re-running parser.py without
+// re-flashing the partition.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <zlib.h>
+
+#include "VerseRender.h"
+
+static const int slotCount = 24 * 60;
+static const uint32_t partitionSize = 0x240000;  // frames partition in partitions_frames.csv
+// Refuse images above 90% of the partition: the rest is headroom for longer
+// verses or layout changes, better to notice here than when flashing
+static const uint32_t fillLimit = partitionSize / 10 * 9;
+
+static void put16(std::vector<uint8_t> &out, size_t pos, uint16_t v)
+{
+    out[pos] = v & 0xFF;
+    out[pos + 1] = v >> 8;
+}
+
+static void put32(std::vector<uint8_t> &out, size_t pos, uint32_t v)
+{
+    for (int i = 0; i < 4; i++) {
+        out[pos + i] = (v >> (8 * i)) & 0xFF;
+    }
+}
+
+static uint32_t get32(const std::vector<uint8_t> &in, size_t pos)
+{
+    return in[pos] | (in[pos + 1] << 8) | (in[pos + 2] << 16) | ((uint32_t)in[pos + 3] << 24);
+}
+
+static bool readFile(const char *path, std::vector<uint8_t> &data)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    data.resize(ftell(f));
+    fseek(f, 0, SEEK_SET);
+    bool ok = fread(data.data(), 1, data.size(), f) == data.size();
+    fclose(f);
+    return ok;
+}
+
+static bool deflateRaw(const UBYTE *plane, size_t len, std::vector<uint8_t> &out)
+{
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    if (deflateInit2(&zs, Z_BEST_COMPRESSION, Z_DEFLATED, -15, 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return false;
+    }
+    out.resize(deflateBound(&zs, len));
+    zs.next_in = (Bytef *)plane;
+    zs.avail_in = len;
+    zs.next_out = out.data();
+    zs.avail_out = out.size();
+    int status = deflate(&zs, Z_FINISH);
+    out.resize(zs.total_out);
+    deflateEnd(&zs);
+    return status == Z_STREAM_END;
+}
+
+int main(int argc, char **argv)
+{
+    const char *indexPath = argc > 1 ? argv[1] : "data/verses.bin";
+    const char *outPath = argc > 2 ? argv[2] : "frames.bin";
+
+    std::vector<uint8_t> index;
+    if (!readFile(indexPath, index) || index.size() < 16 + slotCount * 8 ||
+        memcmp(index.data(), "BVRS", 4) != 0 ||
+        (index[4] | (index[5] << 8)) != 1 || (index[6] | (index[7] << 8)) != slotCount) {
+        fprintf(stderr, "%s: not a verse index (run parser.py index data)\n", indexPath);
+        return 1;
+    }
+
+    const UWORD planeSize = ((EPD_3IN52B_WIDTH % 8 == 0) ? (EPD_3IN52B_WIDTH / 8) : (EPD_3IN52B_WIDTH / 8 + 1))
+                            * EPD_3IN52B_HEIGHT;
+    std::vector<UBYTE> plane(planeSize);
+    Paint_NewImage(plane.data(), EPD_3IN52B_WIDTH, EPD_3IN52B_HEIGHT, 90, WHITE);
+
+    const size_t tableStart = 16;
+    std::vector<uint8_t> out(tableStart + slotCount * 12, 0);
+    std::vector<uint8_t> packed;
+    char bookName[256];
+    int frames = 0;
+
+    for (int slot = 0; slot < slotCount; slot++) {
+        size_t entry = 16 + slot * 8;
+        uint32_t offset = get32(index, entry);
+        uint16_t refLen = index[entry + 4] | (index[entry + 5] << 8);
+        uint16_t textLen = index[entry + 6] | (index[entry + 7] << 8);
+        if (textLen == 0 || offset >= index.size() ||
+            (size_t)refLen + 1 + textLen + 1 > index.size() - offset) {
+            continue; // Nothing to show, the firmware skips this minute too
+        }
+        const char *reference = (const char *)&index[offset];
+        const char *text = (const char *)&index[offset + refLen + 1];
+
+        bool hasBook = VerseRender_BookName(reference, bookName, sizeof(bookName)) > 0;
+        VerseRender_Verse(plane.data(), text, hasBook);
+
+        if (!deflateRaw(plane.data(), planeSize, packed)) {
+            fprintf(stderr, "deflate failed for slot %d\n", slot);
+            return 1;
+        }
+        UBYTE hasBookByte = hasBook ? 1 : 0;
+        uint32_t crc = crc32(0, (const Bytef *)text, textLen);
+        crc = crc32(crc, &hasBookByte, 1);
+
+        size_t pos = tableStart + slot * 12;
+        put32(out, pos, out.size());
+        put32(out, pos + 4, packed.size());
+        put32(out, pos + 8, crc);
+        out.insert(out.end(), packed.begin(), packed.end());
+        frames++;
+    }
+
+    memcpy(out.data(), "BVFR", 4);
+    put16(out, 4, 1);
+    put16(out, 6, slotCount);
+    put32(out, 8, planeSize);
+    put32(out, 12, out.size());
+
+    printf("%d frames, %zu bytes (%.1f%% of the frames partition)\n",
+           frames, out.size(), 100.0 * out.size() / partitionSize);
+    if (out.size() > fillLimit) {
+        fprintf(stderr, "Image exceeds the %u byte limit (90%% of the frames partition), "
+                        "enlarge it in partitions_frames.csv\n", (unsigned)fillLimit);
+        return 1;
+    }
+
+    FILE *f = fopen(outPath, "wb");
+    if (!f || fwrite(out.data(), 1, out.size(), f) != out.size()) {
+        fprintf(stderr, "%s: write failed\n", outPath);
+        return 1;
+    }
+    fclose(f);
+    return 0;
+}